@@ -32,23 +32,33 @@
 #include <bitcoin/database/locks/interprocess_lock.hpp>
 #include <bitcoin/database/locks/locks.hpp>
 #include <bitcoin/database/memory/accessor.hpp>
+#include <bitcoin/database/memory/advice.hpp>
+#include <bitcoin/database/memory/epoch.hpp>
 #include <bitcoin/database/memory/finalizer.hpp>
 #include <bitcoin/database/memory/map.hpp>
 #include <bitcoin/database/memory/memory.hpp>
+#include <bitcoin/database/memory/ram_storage.hpp>
 #include <bitcoin/database/memory/reader.hpp>
+#include <bitcoin/database/memory/recycler.hpp>
 #include <bitcoin/database/memory/simple_reader.hpp>
 #include <bitcoin/database/memory/simple_writer.hpp>
 #include <bitcoin/database/memory/streamers.hpp>
+#include <bitcoin/database/memory/striped_counter.hpp>
 #include <bitcoin/database/memory/utilities.hpp>
 #include <bitcoin/database/memory/interfaces/memory.hpp>
 #include <bitcoin/database/memory/interfaces/storage.hpp>
+#include <bitcoin/database/primitives/arena.hpp>
 #include <bitcoin/database/primitives/arraymap.hpp>
+#include <bitcoin/database/primitives/cursor.hpp>
+#include <bitcoin/database/primitives/filter.hpp>
+#include <bitcoin/database/primitives/hashers.hpp>
 #include <bitcoin/database/primitives/hashmap.hpp>
 #include <bitcoin/database/primitives/head.hpp>
 #include <bitcoin/database/primitives/iterator.hpp>
 #include <bitcoin/database/primitives/linkage.hpp>
 #include <bitcoin/database/primitives/manager.hpp>
 #include <bitcoin/database/primitives/primitives.hpp>
+#include <bitcoin/database/primitives/view.hpp>
 #include <bitcoin/database/tables/context.hpp>
 #include <bitcoin/database/tables/event.hpp>
 #include <bitcoin/database/tables/schema.hpp>
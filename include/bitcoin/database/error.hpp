@@ -84,6 +84,8 @@ enum error_t : uint8_t
     backup_table,
     restore_table,
     verify_table,
+    rebuild_table,
+    store_version,
 
     /// validation/confirmation
     tx_connected,
@@ -79,6 +79,11 @@ BCD_API code close_ex(int file_descriptor) NOEXCEPT;
 BCD_API bool size(size_t& out, int file_descriptor) NOEXCEPT;
 BCD_API code size_ex(size_t& out, int file_descriptor) NOEXCEPT;
 
+/// Read/write size bytes from/to the start of the file (not synchronized).
+BCD_API bool read(int file_descriptor, uint8_t* data, size_t size) NOEXCEPT;
+BCD_API bool write(int file_descriptor, const uint8_t* data,
+    size_t size) NOEXCEPT;
+
 /// File size from name.
 BCD_API bool size(size_t& out, const path& filename) NOEXCEPT;
 BCD_API code size_ex(size_t& out, const path& filename) NOEXCEPT;
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_RECYCLER_IPP
+#define LIBBITCOIN_DATABASE_MEMORY_RECYCLER_IPP
+
+#include <new>
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+TEMPLATE
+template <typename Other>
+inline CLASS::recycler(const recycler<Other>&) NOEXCEPT
+{
+}
+
+TEMPLATE
+inline Type* CLASS::allocate(size_t count) NOEXCEPT
+{
+    if (system::is_one(count))
+    {
+        auto& pool = get_cache();
+        if (!system::is_zero(pool.count))
+            return static_cast<Type*>(pool.blocks[--pool.count]);
+    }
+
+    // Throws bad_alloc (terminates) on exhaustion, as does make_shared.
+    return static_cast<Type*>(::operator new(count * sizeof(Type)));
+}
+
+TEMPLATE
+inline void CLASS::deallocate(Type* block, size_t count) NOEXCEPT
+{
+    if (system::is_one(count))
+    {
+        auto& pool = get_cache();
+        if (pool.count < limit)
+        {
+            pool.blocks[pool.count++] = block;
+            return;
+        }
+    }
+
+    ::operator delete(block);
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline CLASS::cache::~cache() NOEXCEPT
+{
+    while (!system::is_zero(count))
+        ::operator delete(blocks[--count]);
+}
+
+TEMPLATE
+inline typename CLASS::cache& CLASS::get_cache() NOEXCEPT
+{
+    static thread_local cache pool{};
+    return pool;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
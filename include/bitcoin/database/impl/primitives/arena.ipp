@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_PRIMITIVES_ARENA_IPP
+#define LIBBITCOIN_DATABASE_PRIMITIVES_ARENA_IPP
+
+#include <algorithm>
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+TEMPLATE
+CLASS::arena(Table& table, const link& reservation) NOEXCEPT
+  : table_(table),
+    reservation_(reservation.is_terminal() ? integer{} : reservation.value)
+{
+}
+
+TEMPLATE
+CLASS::~arena() NOEXCEPT
+{
+    release();
+}
+
+TEMPLATE
+typename CLASS::link CLASS::remaining() const NOEXCEPT
+{
+    return { system::possible_narrow_cast<integer>(end_ - next_) };
+}
+
+TEMPLATE
+typename CLASS::link CLASS::allocate(const link& size) NOEXCEPT
+{
+    using namespace system;
+    if (size.is_terminal())
+        return size;
+
+    if (size.value > end_ - next_)
+    {
+        // Return remainder so that the next reservation may be contiguous.
+        release();
+
+        // Bump allocation failure is a table allocation failure.
+        const auto chunk = std::max(size.value, reservation_);
+        const auto start = table_.allocate(chunk);
+        if (start.is_terminal() || is_add_overflow(start.value, chunk))
+            return link::terminal;
+
+        next_ = start.value;
+        end_ = start.value + chunk;
+    }
+
+    const auto start = next_;
+    next_ += size.value;
+    return { start };
+}
+
+TEMPLATE
+bool CLASS::release() NOEXCEPT
+{
+    if (next_ == end_)
+        return true;
+
+    // Remainder is retained as padding if it is not at the end of the body.
+    const auto returned = table_.deallocate(next_, end_ - next_);
+    next_ = end_;
+    return returned;
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -63,7 +63,7 @@ bool CLASS::restore() NOEXCEPT
 }
 
 TEMPLATE
-bool CLASS::verify() const NOEXCEPT
+bool CLASS::verify() NOEXCEPT
 {
     Link count{};
     return head_.verify() &&
@@ -97,6 +97,13 @@ Link CLASS::count() const NOEXCEPT
     return manager_.count();
 }
 
+TEMPLATE
+bool CLASS::advise(const Link& link, const Link& size,
+    advice_t advice) const NOEXCEPT
+{
+    return manager_.advise(link, size, advice);
+}
+
 TEMPLATE
 bool CLASS::truncate(const Link& count) NOEXCEPT
 {
@@ -127,6 +134,18 @@ code CLASS::reload() NOEXCEPT
 // query interface
 // ----------------------------------------------------------------------------
 
+TEMPLATE
+Link CLASS::allocate(const Link& size) NOEXCEPT
+{
+    return manager_.allocate(size);
+}
+
+TEMPLATE
+bool CLASS::deallocate(const Link& link, const Link& size) NOEXCEPT
+{
+    return manager_.deallocate(link, size);
+}
+
 TEMPLATE
 template <typename Element, if_equal<Element::size, Size>>
 bool CLASS::get(const Link& link, Element& element) const NOEXCEPT
@@ -136,10 +155,21 @@ bool CLASS::get(const Link& link, Element& element) const NOEXCEPT
     if (!ptr)
         return false;
 
-    iostream stream{ *ptr };
-    reader source{ stream };
-    if constexpr (!is_slab) { source.set_limit(Size); }
-    return element.from_data(source);
+    // Fixed size elements may bypass the stream, bound is checked once.
+    if constexpr (is_view_readable<Element, Size>)
+    {
+        if (is_lesser(ptr->size(), Size))
+            return false;
+
+        return element.from_view(ptr->begin());
+    }
+    else
+    {
+        iostream stream{ *ptr };
+        reader source{ stream };
+        if constexpr (!is_slab) { source.set_limit(Size); }
+        return element.from_data(source);
+    }
 }
 
 TEMPLATE
@@ -152,19 +182,36 @@ bool CLASS::put(const Element& element) NOEXCEPT
 
 TEMPLATE
 template <typename Element, if_equal<Element::size, Size>>
-bool CLASS::put_link(Link& link, const Element& element) NOEXCEPT
+bool CLASS::put(const Link& link, const Element& element) NOEXCEPT
 {
     using namespace system;
-    const auto count = element.count();
-    link = manager_.allocate(count);
     const auto ptr = manager_.get(link);
     if (!ptr)
         return false;
 
-    iostream stream{ *ptr };
-    flipper sink{ stream };
-    if constexpr (!is_slab) { sink.set_limit(Size * count); }
-    return element.to_data(sink);
+    if constexpr (is_view_writable<Element, Size>)
+    {
+        if (is_lesser(ptr->size(), Size))
+            return false;
+
+        element.to_view(ptr->begin());
+        return true;
+    }
+    else
+    {
+        iostream stream{ *ptr };
+        flipper sink{ stream };
+        if constexpr (!is_slab) { sink.set_limit(Size * element.count()); }
+        return element.to_data(sink);
+    }
+}
+
+TEMPLATE
+template <typename Element, if_equal<Element::size, Size>>
+bool CLASS::put_link(Link& link, const Element& element) NOEXCEPT
+{
+    link = manager_.allocate(element.count());
+    return put(link, element);
 }
 
 TEMPLATE
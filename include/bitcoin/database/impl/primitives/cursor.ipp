@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_PRIMITIVES_CURSOR_IPP
+#define LIBBITCOIN_DATABASE_PRIMITIVES_CURSOR_IPP
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+TEMPLATE
+INLINE CLASS::cursor(const manager& body, const Link& start,
+    const Key& key, striped_counter::pin&& pin, pinner&& repin) NOEXCEPT
+  : body_(body), repin_(std::move(repin)), key_(key), link_(start)
+{
+    // The pin is released once the first match (or terminal) is found.
+    const auto hold = std::move(pin);
+    if (!read())
+        next();
+}
+
+TEMPLATE
+INLINE bool CLASS::advance() NOEXCEPT
+{
+    if (!repin_ || link_.is_terminal())
+        return next();
+
+    // A split may have relinked self since its next was read. Self matches
+    // key, so it remains in the key's conflict list (splits preserve order),
+    // and its next is reread under the new pin.
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto pin = repin_();
+    BC_POP_WARNING()
+
+    read();
+    return next();
+}
+
+TEMPLATE
+INLINE const Link& CLASS::self() const NOEXCEPT
+{
+    return link_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+INLINE bool CLASS::next() NOEXCEPT
+{
+    while (!link_.is_terminal())
+    {
+        link_ = next_;
+        if (read())
+            return true;
+    }
+
+    return false;
+}
+
+TEMPLATE
+INLINE bool CLASS::read() NOEXCEPT
+{
+    // Only the next link and key are copied, memory is released on return.
+    std::array<uint8_t, Link::size + array_count<Key>> element{};
+    if (!body_.copy(element.data(), link_, element.size()))
+    {
+        next_ = Link::terminal;
+        return false;
+    }
+
+    next_ = system::unsafe_array_cast<uint8_t, Link::size>(element.data());
+    return std::equal(key_.begin(), key_.end(),
+        std::next(element.begin(), Link::size));
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_PRIMITIVES_FILTER_IPP
+#define LIBBITCOIN_DATABASE_PRIMITIVES_FILTER_IPP
+
+#include <algorithm>
+#include <atomic>
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+TEMPLATE
+CLASS::filter(size_t bytes) NOEXCEPT
+  : words_(to_words(bytes))
+{
+}
+
+TEMPLATE
+bool CLASS::enabled() const NOEXCEPT
+{
+    return !words_.empty();
+}
+
+TEMPLATE
+void CLASS::clear() NOEXCEPT
+{
+    for (auto& value: words_)
+        value.store(0, std::memory_order_relaxed);
+
+    ready_.store(true, std::memory_order_release);
+}
+
+TEMPLATE
+void CLASS::reset() NOEXCEPT
+{
+    ready_.store(false, std::memory_order_release);
+    for (auto& value: words_)
+        value.store(0, std::memory_order_relaxed);
+}
+
+TEMPLATE
+void CLASS::set_ready() NOEXCEPT
+{
+    // Release pairs with acquire in contains (adds precede ready).
+    ready_.store(true, std::memory_order_release);
+}
+
+TEMPLATE
+bool CLASS::is_ready() const NOEXCEPT
+{
+    return ready_.load(std::memory_order_acquire);
+}
+
+TEMPLATE
+void CLASS::add(const Key& key) NOEXCEPT
+{
+    if (!enabled())
+        return;
+
+    // Release pairs with acquire in contains (add precedes head push).
+    const uint64_t hash = mix_hasher::hash(key);
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    words_[to_word(hash)].fetch_or(to_mask(hash), std::memory_order_release);
+    BC_POP_WARNING()
+}
+
+TEMPLATE
+bool CLASS::contains(const Key& key) const NOEXCEPT
+{
+    if (!enabled() || !is_ready())
+        return true;
+
+    const uint64_t hash = mix_hasher::hash(key);
+    const auto mask = to_mask(hash);
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    return (words_[to_word(hash)].load(std::memory_order_acquire) & mask) ==
+        mask;
+    BC_POP_WARNING()
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+constexpr size_t CLASS::to_words(size_t bytes) NOEXCEPT
+{
+    // Word selection is 32 bit, which limits the filter to 32GiB.
+    constexpr auto limit = system::power2<uint64_t>(32u);
+    return system::possible_narrow_cast<size_t>(
+        std::min<uint64_t>(bytes / sizeof(uint64_t), limit));
+}
+
+TEMPLATE
+INLINE size_t CLASS::to_word(uint64_t hash) const NOEXCEPT
+{
+    // Multiply-shift range reduction of the high 32 bits (avoids modulo).
+    return system::possible_narrow_cast<size_t>(
+        ((hash >> 32) * words_.size()) >> 32);
+}
+
+TEMPLATE
+constexpr uint64_t CLASS::to_mask(uint64_t hash) NOEXCEPT
+{
+    // Each probe selects one of 64 bits with 6 of the low 32 hash bits.
+    uint64_t mask{};
+    for (size_t probe{}; probe < probes; ++probe)
+        mask |= system::power2<uint64_t>((hash >> (probe * 6u)) & 63u);
+
+    return mask;
+}
+
+BC_POP_WARNING()
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -19,6 +19,13 @@
 #ifndef LIBBITCOIN_DATABASE_PRIMITIVES_HASHMAP_IPP
 #define LIBBITCOIN_DATABASE_PRIMITIVES_HASHMAP_IPP
 
+#include <algorithm>
+#include <array>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
 #include <bitcoin/system.hpp>
 #include <bitcoin/database/define.hpp>
 
@@ -26,11 +33,21 @@ namespace libbitcoin {
 namespace database {
 
 TEMPLATE
-CLASS::hashmap(storage& header, storage& body, const Link& buckets) NOEXCEPT
-  : head_(header, buckets), manager_(body)
+CLASS::hashmap(storage& header, storage& body, const Link& buckets,
+    size_t load, size_t filter_size, bool fingerprints) NOEXCEPT
+  : load_(is_slab ? zero : load),
+    head_(header, buckets, !is_zero(load_), fingerprints),
+    manager_(body),
+    filter_(filter_size)
 {
 }
 
+TEMPLATE
+CLASS::~hashmap() NOEXCEPT
+{
+    stop_populate();
+}
+
 // not thread safe
 // ----------------------------------------------------------------------------
 
@@ -38,6 +55,8 @@ TEMPLATE
 bool CLASS::create() NOEXCEPT
 {
     Link count{};
+    stop_populate();
+    filter_.clear();
     return head_.create() &&
         head_.get_body_count(count) && manager_.truncate(count);
 }
@@ -45,6 +64,7 @@ bool CLASS::create() NOEXCEPT
 TEMPLATE
 bool CLASS::close() NOEXCEPT
 {
+    stop_populate();
     return head_.set_body_count(manager_.count());
 }
 
@@ -59,15 +79,76 @@ bool CLASS::restore() NOEXCEPT
 {
     Link count{};
     return head_.verify() &&
-        head_.get_body_count(count) && manager_.truncate(count);
+        head_.get_body_count(count) && manager_.truncate(count) &&
+        populate();
 }
 
 TEMPLATE
-bool CLASS::verify() const NOEXCEPT
+bool CLASS::verify() NOEXCEPT
 {
     Link count{};
     return head_.verify() &&
-        head_.get_body_count(count) && count == manager_.count();
+        head_.get_body_count(count) && count == manager_.count() &&
+        populate();
+}
+
+TEMPLATE
+bool CLASS::rebuild() NOEXCEPT
+{
+    // Population walks (slab) conflict lists, so is restarted after.
+    stop_populate();
+
+    // Prior conflict lists are walked from the prior bucket tops.
+    std::vector<Link> tops{};
+    if (!head_.rebucket(tops, manager_.count()))
+        return false;
+
+    // Pin is obtained before the walk, holding the conflict lists of tops.
+    const auto pin = head_.get_pin();
+    const auto memory = manager_.get();
+    if (!memory)
+        return false;
+
+    const auto element = [&memory](const Link& link) NOEXCEPT
+    {
+        using namespace system;
+        constexpr auto size = Link::size + array_count<Key> + Size;
+        const auto value = possible_narrow_cast<size_t>(link.value);
+        if constexpr (is_slab) { return memory->offset(value); }
+        else { return memory->offset(value * size); }
+    };
+
+    // Each element belongs to one prior list, so a list is read in full
+    // before any of its elements is relinked into the new buckets.
+    std::vector<Link> list{};
+    for (const auto& top: tops)
+    {
+        list.clear();
+        for (auto link = top; !link.is_terminal();)
+        {
+            const auto ptr = element(link);
+            if (system::is_null(ptr))
+                return false;
+
+            list.push_back(link);
+            link = system::unsafe_array_cast<uint8_t, Link::size>(ptr);
+        }
+
+        // Pushed from the tail, preserving the order of duplicate keys.
+        for (auto it = list.rbegin(); it != list.rend(); ++it)
+        {
+            const auto ptr = element(*it);
+            const auto& key = system::unsafe_array_cast<uint8_t,
+                array_count<Key>>(std::next(ptr, Link::size));
+            auto& next = system::unsafe_array_cast<uint8_t, Link::size>(ptr);
+            if (!head_.push(*it, next, key))
+                return false;
+        }
+    }
+
+    // The filter is repopulated from the rebuilt buckets.
+    filter_.reset();
+    return populate();
 }
 
 // sizing
@@ -79,6 +160,12 @@ bool CLASS::enabled() const NOEXCEPT
     return head_.buckets() > one;
 }
 
+TEMPLATE
+bool CLASS::is_filtered() const NOEXCEPT
+{
+    return filter_.enabled() && filter_.is_ready();
+}
+
 TEMPLATE
 size_t CLASS::buckets() const NOEXCEPT
 {
@@ -91,6 +178,12 @@ size_t CLASS::head_size() const NOEXCEPT
     return head_.size();
 }
 
+TEMPLATE
+size_t CLASS::to_buckets(size_t head_size, bool fingerprints) NOEXCEPT
+{
+    return head::to_buckets(head_size, fingerprints);
+}
+
 TEMPLATE
 size_t CLASS::body_size() const NOEXCEPT
 {
@@ -103,6 +196,13 @@ Link CLASS::count() const NOEXCEPT
     return manager_.count();
 }
 
+TEMPLATE
+bool CLASS::advise(const Link& link, const Link& size,
+    advice_t advice) const NOEXCEPT
+{
+    return manager_.advise(link, size, advice);
+}
+
 // query interface
 // ----------------------------------------------------------------------------
 
@@ -145,11 +245,80 @@ Link CLASS::first(const Key& key) const NOEXCEPT
     return it(key).self();
 }
 
+TEMPLATE
+bool CLASS::first(std::span<const Key> keys,
+    std::span<Link> links) const NOEXCEPT
+{
+    if (keys.size() != links.size())
+        return false;
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    std::array<bool, group> found{};
+    for (size_t start = 0; start < keys.size(); start += group)
+    {
+        const auto end = std::min(keys.size(), start + group);
+
+        // Pin is obtained before tops, holding the conflict lists of group.
+        const auto pin = head_.get_pin();
+
+        // Filter keys and prefetch the buckets of those possibly present.
+        for (auto index = start; index < end; ++index)
+            if ((found[index - start] = filter_.contains(keys[index])))
+                head_.prefetch(keys[index]);
+
+        // Read tops of the group.
+        for (auto index = start; index < end; ++index)
+            links[index] = found[index - start] ? head_.top(keys[index]) :
+                Link{};
+
+        // Body is obtained after tops (as it()), so that its logical size
+        // includes each top element.
+        const auto body = manager_.get();
+
+        // Prefetch the first element of each conflict list.
+        for (auto index = start; index < end; ++index)
+        {
+            if (body && !links[index].is_terminal())
+            {
+                const auto element = body->offset(
+                    manager::link_to_position(links[index]));
+
+                if (!is_null(element))
+                    prefetch(element);
+            }
+        }
+
+        // Search conflict lists, the pin is held by this loop.
+        for (auto index = start; index < end; ++index)
+            links[index] = iterator{ body, links[index], keys[index] }.self();
+    }
+
+    BC_POP_WARNING()
+    return true;
+}
+
 TEMPLATE
 typename CLASS::iterator CLASS::it(const Key& key) const NOEXCEPT
 {
     // TODO: due to iterator design, key is copied into iterator.
-    return { manager_.get(), head_.top(key), key };
+    // Pin is obtained before top, holding the conflict list until disposed.
+    // A filtered key is definitely not present, so the body is not read.
+    auto pin = head_.get_pin();
+    const auto top = filter_.contains(key) ? head_.top(key) : Link{};
+    return { manager_.get(), top, key, std::move(pin) };
+}
+
+TEMPLATE
+typename CLASS::cursor CLASS::find(const Key& key) const NOEXCEPT
+{
+    // Pin is obtained before top, holding the conflict list until the first
+    // match, and each advance is then pinned (resizing is not held off).
+    auto pin = head_.get_pin();
+    const auto top = filter_.contains(key) ? head_.top(key) : Link{};
+    return { manager_, top, key, std::move(pin), [this]() NOEXCEPT
+    {
+        return head_.get_pin();
+    } };
 }
 
 TEMPLATE
@@ -158,6 +327,12 @@ Link CLASS::allocate(const Link& size) NOEXCEPT
     return manager_.allocate(size);
 }
 
+TEMPLATE
+bool CLASS::deallocate(const Link& link, const Link& size) NOEXCEPT
+{
+    return manager_.deallocate(link, size);
+}
+
 TEMPLATE
 Key CLASS::get_key(const Link& link) NOEXCEPT
 {
@@ -181,12 +356,24 @@ bool CLASS::get(const Link& link, Element& element) const NOEXCEPT
     if (!ptr)
         return false;
 
-    iostream stream{ *ptr };
-    reader source{ stream };
-    source.skip_bytes(Link::size + array_count<Key>);
+    // Fixed size elements may bypass the stream, bound is checked once.
+    if constexpr (is_view_readable<Element, Size>)
+    {
+        constexpr auto start = Link::size + array_count<Key>;
+        if (is_lesser(ptr->size(), start + Size))
+            return false;
 
-    if constexpr (!is_slab) { source.set_limit(Size); }
-    return element.from_data(source);
+        return element.from_view(std::next(ptr->begin(), start));
+    }
+    else
+    {
+        iostream stream{ *ptr };
+        reader source{ stream };
+        source.skip_bytes(Link::size + array_count<Key>);
+
+        if constexpr (!is_slab) { source.set_limit(Size); }
+        return element.from_data(source);
+    }
 }
 
 TEMPLATE
@@ -198,12 +385,24 @@ bool CLASS::set(const Link& link, const Element& element) NOEXCEPT
     if (!ptr)
         return false;
 
-    iostream stream{ *ptr };
-    finalizer sink{ stream };
-    sink.skip_bytes(Link::size + array_count<Key>);
+    if constexpr (is_view_writable<Element, Size>)
+    {
+        constexpr auto start = Link::size + array_count<Key>;
+        if (is_lesser(ptr->size(), start + Size))
+            return false;
+
+        element.to_view(std::next(ptr->begin(), start));
+        return true;
+    }
+    else
+    {
+        iostream stream{ *ptr };
+        finalizer sink{ stream };
+        sink.skip_bytes(Link::size + array_count<Key>);
 
-    if constexpr (!is_slab) { sink.set_limit(Size); }
-    return element.to_data(sink);
+        if constexpr (!is_slab) { sink.set_limit(Size); }
+        return element.to_data(sink);
+    }
 }
 
 TEMPLATE
@@ -235,25 +434,8 @@ template <typename Element, if_equal<Element::size, Size>>
 bool CLASS::put_link(Link& link, const Key& key,
     const Element& element) NOEXCEPT
 {
-    using namespace system;
-    const auto count = element.count();
-    link = allocate(count);
-    const auto ptr = manager_.get(link);
-    if (!ptr)
-        return false;
-
-    iostream stream{ *ptr };
-    finalizer sink{ stream };
-    sink.skip_bytes(Link::size);
-    sink.write_bytes(key);
-    sink.set_finalizer([this, link, index = head_.index(key), ptr]() NOEXCEPT
-    {
-        auto& next = unsafe_array_cast<uint8_t, Link::size>(ptr->begin());
-        return head_.push(link, next, index);
-    });
-
-    if constexpr (!is_slab) { sink.set_limit(Size * count); }
-    return element.to_data(sink) && sink.finalize();
+    link = allocate(element.count());
+    return put(link, key, element);
 }
 
 TEMPLATE
@@ -269,46 +451,283 @@ bool CLASS::put(const Link& link, const Key& key,
     const Element& element) NOEXCEPT
 {
     using namespace system;
-    const auto count = element.count();
-    const auto ptr = manager_.get(link);
-    if (!ptr)
-        return false;
 
-    iostream stream{ *ptr };
-    finalizer sink{ stream };
-    sink.skip_bytes(Link::size);
-    sink.write_bytes(key);
-    sink.set_finalizer([this, link, index = head_.index(key), ptr]() NOEXCEPT
+    // Memory is released before rehash, as a split obtains memory.
     {
-        auto& next = unsafe_array_cast<uint8_t, Link::size>(ptr->begin());
-        return head_.push(link, next, index);
-    });
-
-    if constexpr (!is_slab) { sink.set_limit(Size * count); }
-    return element.to_data(sink) && sink.finalize();
-    return false;
+        const auto ptr = manager_.get(link);
+        if (!ptr)
+            return false;
+
+        if constexpr (is_view_writable<Element, Size>)
+        {
+            constexpr auto start = Link::size + array_count<Key>;
+            if (is_lesser(ptr->size(), start + Size))
+                return false;
+
+            unsafe_array_cast<uint8_t, array_count<Key>>(std::next(
+                ptr->begin(), Link::size)) = key;
+            element.to_view(std::next(ptr->begin(), start));
+
+            auto& next = unsafe_array_cast<uint8_t, Link::size>(ptr->begin());
+            filter_.add(key);
+            if (!head_.push(link, next, key))
+                return false;
+        }
+        else
+        {
+            iostream stream{ *ptr };
+            finalizer sink{ stream };
+            sink.skip_bytes(Link::size);
+            sink.write_bytes(key);
+            sink.set_finalizer([this, link, &key, ptr]() NOEXCEPT
+            {
+                auto& next = unsafe_array_cast<uint8_t, Link::size>(
+                    ptr->begin());
+                filter_.add(key);
+                return head_.push(link, next, key);
+            });
+
+            if constexpr (!is_slab) { sink.set_limit(Size * element.count()); }
+            if (!element.to_data(sink) || !sink.finalize())
+                return false;
+        }
+    }
+
+    rehash();
+    return true;
 }
 
 TEMPLATE
 bool CLASS::commit(const Link& link, const Key& key) NOEXCEPT
 {
-    const auto ptr = manager_.get(link);
-    if (!ptr)
+    // Memory is released before rehash, as a split obtains memory.
+    {
+        const auto ptr = manager_.get(link);
+        if (!ptr)
+            return false;
+
+        // Set element search key.
+        system::unsafe_array_cast<uint8_t, array_count<Key>>(std::next(
+            ptr->begin(), Link::size)) = key;
+
+        // Commit element to search index.
+        auto& next = system::unsafe_array_cast<uint8_t, Link::size>(
+            ptr->begin());
+        filter_.add(key);
+        if (!head_.push(link, next, key))
+            return false;
+    }
+
+    rehash();
+    return true;
+}
+
+TEMPLATE
+Link CLASS::commit_link(const Link& link, const Key& key) NOEXCEPT
+{
+    return commit(link, key) ? link : Link{};
+}
+
+// resizing
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+bool CLASS::split() NOEXCEPT
+{
+    // Body is pinned before buckets are locked, as a body remap waits on pins.
+    const auto memory = manager_.get();
+    if (!memory)
         return false;
 
-    // Set element search key.
-    system::unsafe_array_cast<uint8_t, array_count<Key>>(std::next(
-        ptr->begin(), Link::size)) = key;
+    Link from{};
+    Link to{};
+    Link top{};
+    if (!head_.begin_split(from, to, top))
+        return false;
 
-    // Commit element to search index.
-    auto& next = system::unsafe_array_cast<uint8_t, Link::size>(ptr->begin());
-    return head_.push(link, next, head_.index(key));
+    // Partition the conflict list, preserving order within each part.
+    using part = std::vector<std::pair<Link, uint8_t*>>;
+    constexpr auto size = Link::size + array_count<Key> + Size;
+    part stay{};
+    part move{};
+    for (auto link = top; !link.is_terminal();)
+    {
+        using namespace system;
+        const auto position = possible_narrow_cast<size_t>(link.value) * size;
+        const auto element = memory->offset(position);
+        if (is_null(element))
+        {
+            head_.abort_split();
+            return false;
+        }
+
+        const auto& key = unsafe_array_cast<uint8_t, array_count<Key>>(
+            std::next(element, Link::size));
+        auto& target = (head_.split_index(key) == from) ? stay : move;
+        target.emplace_back(link, element);
+        link = unsafe_array_cast<uint8_t, Link::size>(element);
+    }
+
+    // No iterator is pinned and pushes to both buckets are locked out, so
+    // each part is relinked in place (from its tail) and its top returned.
+    const auto relink = [](const part& elements) NOEXCEPT
+    {
+        Link next{};
+        for (auto it = elements.rbegin(); it != elements.rend(); ++it)
+        {
+            system::unsafe_array_cast<uint8_t, Link::size>(it->second) = next;
+            next = it->first;
+        }
+
+        return next;
+    };
+
+    head_.end_split(relink(stay), relink(move));
+    return true;
 }
 
+// private
+// ----------------------------------------------------------------------------
+
 TEMPLATE
-Link CLASS::commit_link(const Link& link, const Key& key) NOEXCEPT
+void CLASS::rehash() NOEXCEPT
 {
-    return commit(link, key) ? link : Link{};
+    if (is_zero(load_))
+        return;
+
+    // Following a deferred split, commits skip rehash until backoff expires,
+    // so that a long pinned reader is not polled by every write.
+    auto defer = backoff_.load(std::memory_order_relaxed);
+    while (!is_zero(defer))
+        if (backoff_.compare_exchange_weak(defer, sub1(defer),
+            std::memory_order_relaxed))
+            return;
+
+    // Splits deferred by pinned readers (or concurrent writers) remain due,
+    // so each commit drains all that are due, stopping when one is deferred.
+    while (manager_.count() > load_ * head_.buckets())
+    {
+        if (!split())
+        {
+            backoff_.store(split_backoff, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+TEMPLATE
+bool CLASS::populate() NOEXCEPT
+{
+    stop_populate();
+    if (!filter_.enabled())
+        return true;
+
+    filter_.reset();
+
+    // Lookups search the body until the filter is ready, so open does not
+    // wait on a scan of every element.
+    try
+    {
+        populator_ = std::thread([this]() NOEXCEPT
+        {
+            if (populate_())
+                filter_.set_ready();
+        });
+    }
+    catch (const std::system_error&)
+    {
+        if (!populate_())
+            return false;
+
+        filter_.set_ready();
+    }
+
+    return true;
+}
+
+TEMPLATE
+void CLASS::stop_populate() NOEXCEPT
+{
+    if (!populator_.joinable())
+        return;
+
+    stopping_.store(true, std::memory_order_relaxed);
+    populator_.join();
+    stopping_.store(false, std::memory_order_relaxed);
+}
+
+TEMPLATE
+bool CLASS::populate_() NOEXCEPT
+{
+    using namespace system;
+    constexpr auto key_size = array_count<Key>;
+    const auto add = [this](const uint8_t* element) NOEXCEPT
+    {
+        filter_.add(unsafe_array_cast<uint8_t, key_size>(
+            std::next(element, Link::size)));
+    };
+
+    // Memory (and buckets) are pinned per chunk, so that a long scan does not
+    // hold a body epoch over many remaps, or preclude splitting.
+    constexpr size_t chunk = 4096;
+
+    if constexpr (is_slab)
+    {
+        // Slabs are not self-sized, so conflict lists are walked.
+        for (size_t bucket{}; bucket < head_.buckets();)
+        {
+            if (stopping_.load(std::memory_order_relaxed))
+                return false;
+
+            const auto pin = head_.get_pin();
+            const auto memory = manager_.get();
+            if (!memory)
+                return false;
+
+            const auto end = std::min(bucket + chunk, head_.buckets());
+            for (; bucket < end; ++bucket)
+            {
+                for (auto link = head_.top(Link{ bucket }); !link.is_terminal();)
+                {
+                    const auto element = memory->offset(
+                        possible_narrow_cast<size_t>(link.value));
+                    if (is_null(element))
+                        return false;
+
+                    add(element);
+                    link = unsafe_array_cast<uint8_t, Link::size>(element);
+                }
+            }
+        }
+    }
+    else
+    {
+        // Records are read in order, uncommitted records are false positives.
+        // Records committed after count are added to the filter by commit.
+        constexpr auto size = Link::size + key_size + Size;
+        const auto count = possible_narrow_cast<size_t>(manager_.count().value);
+        for (size_t record{}; record < count;)
+        {
+            if (stopping_.load(std::memory_order_relaxed))
+                return false;
+
+            const auto memory = manager_.get();
+            if (!memory)
+                return false;
+
+            const auto end = std::min(record + chunk, count);
+            for (; record < end; ++record)
+            {
+                const auto element = memory->offset(record * size);
+                if (is_null(element))
+                    return false;
+
+                add(element);
+            }
+        }
+    }
+
+    return true;
 }
 
 } // namespace database
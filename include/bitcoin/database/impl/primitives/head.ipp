@@ -20,6 +20,10 @@
 #define LIBBITCOIN_DATABASE_PRIMITIVES_HEAD_IPP
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <thread>
 #include <bitcoin/system.hpp>
 #include <bitcoin/database/define.hpp>
 
@@ -27,39 +31,35 @@ namespace libbitcoin {
 namespace database {
 
 TEMPLATE
-CLASS::head(storage& head, const Link& buckets) NOEXCEPT
-  : file_(head), buckets_(buckets)
+CLASS::head(storage& head, const Link& buckets, bool resizable,
+    bool fingerprints) NOEXCEPT
+  : file_(head),
+    buckets_(buckets),
+    mask_(to_mask(buckets)),
+    resizable_(resizable && is_nonzero(buckets)),
+    fingerprints_(fingerprints && is_nonzero(buckets)),
+    slot_(slot_size(fingerprints_)),
+    count_(buckets)
 {
 }
 
 TEMPLATE
 size_t CLASS::size() const NOEXCEPT
 {
-    return offset(buckets_);
+    return offset(buckets());
 }
 
 TEMPLATE
 size_t CLASS::buckets() const NOEXCEPT
 {
-    return buckets_;
+    return count_.load(std::memory_order_acquire);
 }
 
 TEMPLATE
 Link CLASS::index(const Key& key) const NOEXCEPT
 {
     BC_ASSERT_MSG(is_nonzero(buckets_), "hash table requires buckets");
-
-    // TODO: for greater flexibility, inject hash function through template.
-    if constexpr (Hash)
-    {
-        // djb2_hash exhibits very poor uniqueness result for sequential keys.
-        return system::djb2_hash(key) % buckets_;
-    }
-    else
-    {
-        // unique_hash assumes sufficient uniqueness in low order key bytes.
-        return unique_hash(key) % buckets_;
-    }
+    return to_index(Hash::hash(key), buckets());
 }
 
 TEMPLATE
@@ -68,6 +68,8 @@ bool CLASS::create() NOEXCEPT
     if (is_nonzero(file_.size()))
         return false;
 
+    count_.store(buckets_, std::memory_order_release);
+
     const auto allocation = size();
     const auto start = file_.allocate(allocation);
 
@@ -84,13 +86,55 @@ bool CLASS::create() NOEXCEPT
     // std::memset/fill_n have identical performance (on win32).
     ////std::memset(ptr->begin(), system::bit_all<uint8_t>, allocation);
     std::fill_n(ptr->begin(), allocation, system::bit_all<uint8_t>);
+
+    // Empty buckets have no fingerprints.
+    if (fingerprints_)
+    {
+        for (size_t bucket{}; bucket < buckets(); ++bucket)
+            std::fill_n(std::next(ptr->begin(), offset(bucket) + Link::size),
+                sizeof(fingerprint), uint8_t{});
+    }
+
     return set_body_count(zero);
 }
 
 TEMPLATE
-bool CLASS::verify() const NOEXCEPT
+bool CLASS::verify() NOEXCEPT
 {
-    return file_.size() == size();
+    const auto length = file_.size();
+    if (!resizable_)
+        return length == size();
+
+    // Split buckets are appended, so the bucket count is implied by size.
+    if (length < offset(buckets_) || !is_zero((length - Link::size) % slot_))
+        return false;
+
+    count_.store((length - Link::size) / slot_, std::memory_order_release);
+    return true;
+}
+
+TEMPLATE
+bool CLASS::rebucket(std::vector<Link>& tops, const Link& count) NOEXCEPT
+{
+    // The prior bucket count is implied by the head size.
+    const auto length = file_.size();
+    if (length < Link::size || !is_zero((length - Link::size) % slot_))
+        return false;
+
+    // Memory is released before truncation, as a remap waits on pins.
+    {
+        const auto ptr = file_.get();
+        if (!ptr || Link{ array_cast<Link::size>(*ptr) } != count)
+            return false;
+
+        tops.clear();
+        tops.reserve((length - Link::size) / slot_);
+        for (auto it = std::next(ptr->begin(), Link::size); it != ptr->end();
+            it = std::next(it, slot_))
+            tops.emplace_back(system::unsafe_array_cast<uint8_t, Link::size>(it));
+    }
+
+    return file_.truncate(zero) && create() && set_body_count(count);
 }
 
 TEMPLATE
@@ -118,7 +162,26 @@ bool CLASS::set_body_count(const Link& count) NOEXCEPT
 TEMPLATE
 Link CLASS::top(const Key& key) const NOEXCEPT
 {
-    return top(index(key));
+    if (!fingerprints_)
+        return top(index(key));
+
+    const auto hash = Hash::hash(key);
+    const auto bucket = to_index(hash, buckets());
+    const auto ptr = file_.get(offset(bucket));
+    if (!ptr)
+        return Link::terminal;
+
+    const auto& head = array_cast<Link::size>(*ptr);
+    auto& mutex = get_mutex(bucket);
+
+    mutex.lock_shared();
+    const auto top = head;
+    const auto prints = get_prints(*ptr);
+    mutex.unlock_shared();
+
+    // A key without its fingerprint in the summary is not in the list.
+    const auto print = to_fingerprint(hash);
+    return (prints & print) == print ? Link{ top } : Link{};
 }
 
 TEMPLATE
@@ -129,35 +192,275 @@ Link CLASS::top(const Link& index) const NOEXCEPT
         return Link::terminal;
 
     const auto& head = array_cast<Link::size>(*ptr);
+    auto& mutex = get_mutex(index);
 
-    mutex_.lock_shared();
+    mutex.lock_shared();
     const auto top = head;
-    mutex_.unlock_shared();
+    mutex.unlock_shared();
     return top;
 }
 
 TEMPLATE
 bool CLASS::push(const bytes& current, bytes& next, const Key& key) NOEXCEPT
 {
-    return push(current, next, index(key));
+    const auto hash = Hash::hash(key);
+    const auto print = to_fingerprint(hash);
+    if (!resizable_)
+        return push(current, next, to_index(hash, buckets()), print);
+
+    // A split may relocate the key before the bucket is locked, so the
+    // index is confirmed under the lock (splits publish under this lock).
+    while (true)
+    {
+        const auto bucket = to_index(hash, buckets());
+        const auto ptr = file_.get(offset(bucket));
+        if (!ptr)
+            return false;
+
+        auto& head = array_cast<Link::size>(*ptr);
+        auto& mutex = get_mutex(bucket);
+
+        mutex.lock();
+        if (bucket == to_index(hash, buckets()))
+        {
+            next = head;
+            head = current;
+            if (fingerprints_) set_prints(*ptr, get_prints(*ptr) | print);
+            mutex.unlock();
+            return true;
+        }
+
+        mutex.unlock();
+    }
 }
 
 TEMPLATE
 bool CLASS::push(const bytes& current, bytes& next, const Link& index) NOEXCEPT
+{
+    return push(current, next, index, system::bit_all<fingerprint>);
+}
+
+TEMPLATE
+void CLASS::prefetch(const Key& key) const NOEXCEPT
+{
+    const auto ptr = file_.get(offset(index(key)));
+    if (ptr)
+        database::prefetch(ptr->begin());
+}
+
+// resizing
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+striped_counter::pin CLASS::get_pin() const NOEXCEPT
+{
+    if (!resizable_)
+        return {};
+
+    // Pin and then confirm no split (splitter flags and then checks pins).
+    while (true)
+    {
+        auto& stripe = readers_.get_stripe();
+        stripe.lock_shared();
+        if (!splitting_.load(std::memory_order_seq_cst))
+            return { stripe, std::adopt_lock };
+
+        stripe.unlock_shared();
+        std::this_thread::yield();
+    }
+}
+
+TEMPLATE
+bool CLASS::begin_split(Link& from, Link& to, Link& top) NOEXCEPT
+{
+    if (!resizable_ || !split_mutex_.try_lock())
+        return false;
+
+    // New readers are not blocked unless drained, so a pinned iterator (or
+    // cursor) defers the split without stalling lookups.
+    if (!readers_.is_drained())
+    {
+        split_mutex_.unlock();
+        return false;
+    }
+
+    // Flag and then check pins (readers pin and then check flag). New readers
+    // wait on the flag, so only those pinned since the above check remain.
+    splitting_.store(true, std::memory_order_seq_cst);
+    for (auto spin = drain_spins; !readers_.is_drained(); --spin)
+    {
+        if (is_zero(spin))
+        {
+            unlock_split();
+            return false;
+        }
+
+        std::this_thread::yield();
+    }
+
+    // Linear hashing splits buckets in order, doubling each round.
+    const auto count = buckets();
+    const auto round = is_zero(mask_) ?
+        buckets_ * std::bit_floor(count / buckets_) : std::bit_floor(count);
+
+    // The new bucket is appended, and index must remain below terminal.
+    if (add1(count) >= Link::terminal ||
+        file_.allocate(slot_) != offset(count))
+    {
+        /* bool */ file_.truncate(offset(count));
+        unlock_split();
+        return false;
+    }
+
+    from_ = count - round;
+    to_ = count;
+
+    // Pushes to either bucket wait, and revalidate after publication.
+    get_mutex(from_).lock();
+    if (&get_mutex(to_) != &get_mutex(from_))
+        get_mutex(to_).lock();
+
+    from = from_;
+    to = to_;
+    top = top_unlocked(from_);
+    return true;
+}
+
+TEMPLATE
+Link CLASS::split_index(const Key& key) const NOEXCEPT
+{
+    return to_index(Hash::hash(key), add1(buckets()));
+}
+
+TEMPLATE
+void CLASS::end_split(const Link& from_top, const Link& to_top) NOEXCEPT
+{
+    set_top_unlocked(from_, from_top);
+    set_top_unlocked(to_, to_top);
+
+    // Fingerprints of the split list are a superset of those of each part.
+    if (fingerprints_)
+    {
+        const auto from = file_.get(offset(from_));
+        const auto to = file_.get(offset(to_));
+        if (from && to)
+            set_prints(*to, get_prints(*from));
+    }
+
+    count_.store(add1(buckets()), std::memory_order_release);
+
+    if (&get_mutex(to_) != &get_mutex(from_))
+        get_mutex(to_).unlock();
+
+    get_mutex(from_).unlock();
+    unlock_split();
+}
+
+TEMPLATE
+void CLASS::abort_split() NOEXCEPT
+{
+    if (&get_mutex(to_) != &get_mutex(from_))
+        get_mutex(to_).unlock();
+
+    get_mutex(from_).unlock();
+    /* bool */ file_.truncate(offset(buckets()));
+    unlock_split();
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+Link CLASS::to_index(size_t hash, size_t count) const NOEXCEPT
+{
+    // Masking is equivalent to modulo for a power of two bucket count.
+    if (count == buckets_)
+        return is_zero(mask_) ? hash % buckets_ : hash & mask_;
+
+    // Buckets below the split point are addressed by the next round.
+    const auto round = is_zero(mask_) ?
+        buckets_ * std::bit_floor(count / buckets_) : std::bit_floor(count);
+    const auto index = is_zero(mask_) ? hash % round : hash & sub1(round);
+    if (index >= count - round)
+        return index;
+
+    const auto next = two * round;
+    return is_zero(mask_) ? hash % next : hash & sub1(next);
+}
+
+TEMPLATE
+bool CLASS::push(const bytes& current, bytes& next, const Link& index,
+    fingerprint print) NOEXCEPT
 {
     const auto ptr = file_.get(offset(index));
     if (!ptr)
         return false;
 
     auto& head = array_cast<Link::size>(*ptr);
+    auto& mutex = get_mutex(index);
 
-    mutex_.lock();
+    mutex.lock();
     next = head;
     head = current;
-    mutex_.unlock();
+    if (fingerprints_) set_prints(*ptr, get_prints(*ptr) | print);
+    mutex.unlock();
     return true;
 }
 
+TEMPLATE
+typename CLASS::fingerprint CLASS::get_prints(memory& bucket) NOEXCEPT
+{
+    const auto& prints = system::unsafe_array_cast<uint8_t, sizeof(fingerprint)>(
+        std::next(bucket.begin(), Link::size));
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    return system::narrow_cast<fingerprint>(prints[0] | (prints[1] << 8));
+    BC_POP_WARNING()
+}
+
+TEMPLATE
+void CLASS::set_prints(memory& bucket, fingerprint prints) NOEXCEPT
+{
+    auto& value = system::unsafe_array_cast<uint8_t, sizeof(fingerprint)>(
+        std::next(bucket.begin(), Link::size));
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    value[0] = system::narrow_cast<uint8_t>(prints);
+    value[1] = system::narrow_cast<uint8_t>(prints >> 8);
+    BC_POP_WARNING()
+}
+
+TEMPLATE
+Link CLASS::top_unlocked(const Link& index) const NOEXCEPT
+{
+    const auto ptr = file_.get(offset(index));
+    return ptr ? Link{ array_cast<Link::size>(*ptr) } : Link{};
+}
+
+TEMPLATE
+void CLASS::set_top_unlocked(const Link& index, const Link& top) NOEXCEPT
+{
+    const auto ptr = file_.get(offset(index));
+    if (ptr)
+        array_cast<Link::size>(*ptr) = top;
+}
+
+TEMPLATE
+void CLASS::unlock_split() NOEXCEPT
+{
+    splitting_.store(false, std::memory_order_seq_cst);
+    split_mutex_.unlock();
+}
+
+TEMPLATE
+std::shared_mutex& CLASS::get_mutex(const Link& index) const NOEXCEPT
+{
+    // Buckets are packed (unaligned) links, so cannot be atomically swapped.
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    return stripes_[index % stripes].mutex;
+    BC_POP_WARNING()
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -20,17 +20,26 @@
 #define LIBBITCOIN_DATABASE_PRIMITIVES_ELEMENT_IPP
 
 ////#include <algorithm>
-////#include <utility>
+#include <utility>
 #include <bitcoin/system.hpp>
 #include <bitcoin/database/define.hpp>
 
+// Wide key comparison is selected at compile time by instruction set.
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define HAVE_ITERATOR_AVX2
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define HAVE_ITERATOR_SSE2
+#endif
+
 namespace libbitcoin {
 namespace database {
 
 TEMPLATE
 INLINE CLASS::iterator(const memory_ptr& data, const Link& start,
-    const Key& key) NOEXCEPT
-  : memory_(data), key_(key), link_(start)
+    const Key& key, striped_counter::pin&& pin) NOEXCEPT
+  : memory_(data), key_(key), pin_(std::move(pin)), link_(start)
 {
     if (!is_match())
         advance();
@@ -42,6 +51,9 @@ INLINE bool CLASS::advance() NOEXCEPT
     while (!link_.is_terminal())
     {
         link_ = get_next();
+
+        // Start the load of the following element while this key compares.
+        prefetch(get_next());
         if (is_match())
             return true;
     }
@@ -67,17 +79,11 @@ INLINE bool CLASS::is_match() const NOEXCEPT
     if (!memory_)
         return false;
 
-    auto link = memory_->offset(link_to_position(link_) + Link::size);
+    const auto link = memory_->offset(link_to_position(link_) + Link::size);
     if (is_null(link))
         return false;
 
-    // TODO: loop unroll.
-    for (const auto& byte: key_)
-        if (byte != *(link++))
-            return false;
-
-    return true;
-    ////return std::equal(key_.begin(), key_.end(), link);
+    return is_equal(link, key_);
 }
 
 TEMPLATE
@@ -96,6 +102,56 @@ INLINE Link CLASS::get_next() const NOEXCEPT
 // private
 // ----------------------------------------------------------------------------
 
+TEMPLATE
+INLINE bool CLASS::is_equal(const uint8_t* bytes, const Key& key) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+
+    // Stored keys are unaligned (offset by link size within the element).
+    if constexpr (array_count<Key> == 32u)
+    {
+#if defined(HAVE_ITERATOR_AVX2)
+        const auto left = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(bytes));
+        const auto right = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(key.data()));
+        return _mm256_movemask_epi8(_mm256_cmpeq_epi8(left, right)) == -1;
+#elif defined(HAVE_ITERATOR_SSE2)
+        const auto left0 = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(bytes));
+        const auto left1 = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(bytes + 16));
+        const auto right0 = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(key.data()));
+        const auto right1 = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(key.data() + 16));
+        const auto equal = _mm_and_si128(_mm_cmpeq_epi8(left0, right0),
+            _mm_cmpeq_epi8(left1, right1));
+        return _mm_movemask_epi8(equal) == 0xffff;
+#endif
+    }
+
+    for (const auto& byte: key)
+        if (byte != *(bytes++))
+            return false;
+
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+    return true;
+}
+
+TEMPLATE
+INLINE void CLASS::prefetch(const Link& link) const NOEXCEPT
+{
+    if (link.is_terminal() || !memory_)
+        return;
+
+    const auto element = memory_->offset(link_to_position(link));
+    if (!is_null(element))
+        database::prefetch(element);
+}
+
 TEMPLATE
 constexpr size_t CLASS::link_to_position(const Link& link) NOEXCEPT
 {
@@ -119,4 +175,7 @@ constexpr size_t CLASS::link_to_position(const Link& link) NOEXCEPT
 } // namespace database
 } // namespace libbitcoin
 
+#undef HAVE_ITERATOR_AVX2
+#undef HAVE_ITERATOR_SSE2
+
 #endif
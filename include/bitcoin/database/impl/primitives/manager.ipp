@@ -68,6 +68,15 @@ Link CLASS::allocate(const Link& size) NOEXCEPT
     return position_to_link(start);
 }
 
+TEMPLATE
+bool CLASS::deallocate(const Link& link, const Link& size) NOEXCEPT
+{
+    if (link.is_terminal() || size.is_terminal())
+        return false;
+
+    return file_.deallocate(link_to_position(link), link_to_position(size));
+}
+
 TEMPLATE
 memory_ptr CLASS::get() const NOEXCEPT
 {
@@ -84,6 +93,26 @@ memory_ptr CLASS::get(const Link& value) const NOEXCEPT
     return file_.get(link_to_position(value));
 }
 
+TEMPLATE
+bool CLASS::copy(uint8_t* to, const Link& link, size_t size) const NOEXCEPT
+{
+    if (link.is_terminal())
+        return false;
+
+    return file_.copy(to, link_to_position(link), size);
+}
+
+TEMPLATE
+bool CLASS::advise(const Link& link, const Link& size,
+    advice_t advice) const NOEXCEPT
+{
+    if (link.is_terminal() || size.is_terminal())
+        return false;
+
+    return file_.advise(link_to_position(link), link_to_position(size),
+        advice);
+}
+
 // Errors.
 // ----------------------------------------------------------------------------
 
@@ -105,9 +134,7 @@ code CLASS::reload() NOEXCEPT
     return file_.load();
 }
 
-// private
-// ----------------------------------------------------------------------------
-
+// static
 TEMPLATE
 constexpr size_t CLASS::link_to_position(const Link& link) NOEXCEPT
 {
@@ -134,6 +161,9 @@ constexpr size_t CLASS::link_to_position(const Link& link) NOEXCEPT
     }
 }
 
+// private
+// ----------------------------------------------------------------------------
+
 TEMPLATE
 constexpr typename Link::integer CLASS::cast_link(size_t link) NOEXCEPT
 {
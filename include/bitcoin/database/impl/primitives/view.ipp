@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_PRIMITIVES_VIEW_IPP
+#define LIBBITCOIN_DATABASE_PRIMITIVES_VIEW_IPP
+
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+TEMPLATE
+INLINE CLASS::view(uint8_t* data) NOEXCEPT
+  : data_(data)
+{
+}
+
+TEMPLATE
+template <size_t Offset, typename Integer, size_t Bytes>
+INLINE Integer CLASS::get() const NOEXCEPT
+{
+    static_assert(Bytes <= sizeof(Integer));
+    static_assert(!system::is_add_overflow(Offset, Bytes));
+    static_assert(Offset + Bytes <= Size);
+
+    // Constant width loops are unrolled (and fused) by the compiler.
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    Integer value{};
+    for (size_t byte = 0; byte < Bytes; ++byte)
+        value |= static_cast<Integer>(static_cast<Integer>(
+            data_[Offset + byte]) << system::to_bits(byte));
+    BC_POP_WARNING()
+
+    return value;
+}
+
+TEMPLATE
+template <size_t Offset, typename Integer, size_t Bytes>
+INLINE void CLASS::set(Integer value) const NOEXCEPT
+{
+    static_assert(Bytes <= sizeof(Integer));
+    static_assert(!system::is_add_overflow(Offset, Bytes));
+    static_assert(Offset + Bytes <= Size);
+
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    for (size_t byte = 0; byte < Bytes; ++byte)
+        data_[Offset + byte] = system::possible_narrow_cast<uint8_t>(
+            value >> system::to_bits(byte));
+    BC_POP_WARNING()
+}
+
+TEMPLATE
+template <size_t Offset, size_t Bytes>
+INLINE system::data_array<Bytes>& CLASS::bytes() const NOEXCEPT
+{
+    static_assert(!system::is_add_overflow(Offset, Bytes));
+    static_assert(Offset + Bytes <= Size);
+
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    return system::unsafe_array_cast<uint8_t, Bytes>(data_ + Offset);
+    BC_POP_WARNING()
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
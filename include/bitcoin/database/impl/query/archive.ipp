@@ -20,6 +20,12 @@
 #define LIBBITCOIN_DATABASE_QUERY_ARCHIVE_IPP
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <thread>
 #include <utility>
 #include <bitcoin/system.hpp>
 #include <bitcoin/database/define.hpp>
@@ -196,12 +202,33 @@ bool CLASS::populate(const transaction& tx) const NOEXCEPT
 TEMPLATE
 bool CLASS::populate(const block& block) const NOEXCEPT
 {
-    auto result = true;
+    // Prevout txs of unpopulated inputs are found in one batched lookup.
+    std_vector<const input*> unpopulated{};
+    std_vector<hash_digest> keys{};
     const auto ins = block.inputs_ptr();
-    std::for_each(ins->begin(), ins->end(), [&](const auto& in) NOEXCEPT
+    unpopulated.reserve(ins->size());
+    keys.reserve(ins->size());
+    for (const auto& in: *ins)
     {
-        result &= populate(*in);
-    });
+        if (!in->prevout && !in->point().is_null())
+        {
+            unpopulated.push_back(in.get());
+            keys.push_back(in->point().hash());
+        }
+    }
+
+    std_vector<tx_link> links(keys.size());
+    if (!store_.tx.first(keys, links))
+        return false;
+
+    // input.metadata is not populated.
+    auto result = true;
+    for (size_t index = 0; index < unpopulated.size(); ++index)
+    {
+        const auto& in = *unpopulated.at(index);
+        in.prevout = get_output(links.at(index), in.point().index());
+        result &= !is_null(in.prevout);
+    }
 
     return result;
 }
@@ -665,14 +692,32 @@ tx_link CLASS::set_link(const transaction& tx) NOEXCEPT
     return set_code(out, tx) ? tx_link{} : out;
 }
 
-// The only multitable write query (except initialize/genesis).
 TEMPLATE
 code CLASS::set_code(tx_link& out_fk, const transaction& tx) NOEXCEPT
+{
+    // Without reservation slabs are allocated as they are written.
+    input_links ins_sizes{};
+    output_links outs_sizes{};
+    push_sizes(ins_sizes, outs_sizes, tx);
+    input_arena inputs{ store_.input };
+    output_arena outputs{ store_.output };
+    return set_code(out_fk, tx, inputs, outputs, ins_sizes, outs_sizes);
+}
+
+// The only multitable write query (except initialize/genesis).
+TEMPLATE
+code CLASS::set_code(tx_link& out_fk, const transaction& tx,
+    input_arena& inputs, output_arena& outputs,
+    std::span<const input_link::integer> ins_sizes,
+    std::span<const output_link::integer> outs_sizes) NOEXCEPT
 {
     using namespace system;
     if (tx.is_empty())
         return error::tx_empty;
 
+    BC_ASSERT(ins_sizes.size() == tx.inputs_ptr()->size());
+    BC_ASSERT(outs_sizes.size() == tx.outputs_ptr()->size());
+
     const auto key = tx.hash(false);
 
     // GUARD (tx redundancy)
@@ -708,21 +753,17 @@ code CLASS::set_code(tx_link& out_fk, const transaction& tx) NOEXCEPT
     if (spend_fk.is_terminal())
         return error::tx_spend_allocate;
 
-    // Commit input records (spend records not indexed).
+    // Commit input records, with one slab allocation and writer for the tx.
+    // Safe allocation failure, blobs linked by unindexed spends.
+    auto input_fk = inputs.allocate(std::accumulate(ins_sizes.begin(),
+        ins_sizes.end(), input_link::integer{}));
+    if (!store_.input.put(input_fk, table::input::put_refs{ {}, ins }))
+        return error::tx_input_put;
+
+    // Create points and write spend records (spend records not indexed).
+    auto input_size = ins_sizes.begin();
     for (const auto& in: ins)
     {
-        // Commit input record.
-        // Safe allocation failure, blob linked by unindexed spend.
-        input_link input_fk{};
-        if (!store_.input.put_link(input_fk, table::input::put_ref
-        {
-            {},
-            *in
-        }))
-        {
-            return error::tx_input_put;
-        }
-
         // Input point aliases.
         const auto& prevout = in->point();
         const auto& hash = prevout.hash();
@@ -762,25 +803,24 @@ code CLASS::set_code(tx_link& out_fk, const transaction& tx) NOEXCEPT
 
         // Acumulate spends (input references) in order.
         puts.spend_fks.push_back(spend_fk.value++);
+
+        // Input slabs are contiguous and in order.
+        input_fk.value += *input_size++;
     }
 
-    // Commit output records.
-    for (const auto& out: outs)
-    {
-        // Safe allocation failure, blob unlinked.
-        output_link output_fk{};
-        if (!store_.output.put_link(output_fk, table::output::put_ref
-        {
-            {},
-            out_fk,
-            *out
-        }))
-        {
-            return error::tx_output_put;
-        }
+    // Commit output records, with one slab allocation and writer for the tx.
+    // Safe allocation failure, blobs unlinked.
+    auto output_fk = outputs.allocate(std::accumulate(outs_sizes.begin(),
+        outs_sizes.end(), output_link::integer{}));
+    if (!store_.output.put(output_fk, table::output::put_refs{ {}, out_fk,
+        outs }))
+        return error::tx_output_put;
 
-        // Acumulate outputs in order.
+    // Acumulate outputs in order (output slabs are contiguous and in order).
+    for (const auto& output_size: outs_sizes)
+    {
         puts.out_fks.push_back(output_fk);
+        output_fk.value += output_size;
     }
 
     // Commit accumulated puts.
@@ -887,6 +927,17 @@ header_link CLASS::set_link(const header& header, const context& ctx) NOEXCEPT
     if (parent_fk.is_terminal() != (parent_sk == system::null_hash))
         return {};
 
+    // Cumulative work is stored so chain state need not scan the chain.
+    uint256_t work{};
+    if (!parent_fk.is_terminal() && !get_cumulative_work(work, parent_fk))
+        return {};
+
+    work += header.proof();
+
+    // Skip link, as bitcoin core pskip (terminal for genesis).
+    const auto skip_fk = parent_fk.is_terminal() ? header_link{} :
+        to_ancestor(parent_fk, to_skip_height(ctx.height));
+
     // ========================================================================
     const auto scope = store_.get_transactor();
 
@@ -896,7 +947,9 @@ header_link CLASS::set_link(const header& header, const context& ctx) NOEXCEPT
         {},
         ctx,
         parent_fk,
-        header
+        header,
+        system::to_hash(work),
+        skip_fk
     });
     // ========================================================================
 }
@@ -961,15 +1014,21 @@ code CLASS::set_code(txs_link& out_fk, const transactions& txs,
     if (!out_fk.is_terminal() && !is_malleable(key))
         return error::success;
 
+    // Parallel archival relies on the tx guard, so requires distinct txs.
+    // Tx links are placed by position, so the txs slab retains block order.
+    // Links increase within each batch but not across a block (see below).
     code ec{};
-    tx_link tx_fk{};
-    tx_links links{};
-    links.reserve(txs.size());
-    for (const auto& tx: txs)
-    {
-        if ((ec = set_code(tx_fk, *tx))) return ec;
-        links.push_back(tx_fk.value);
-    }
+    tx_links links(txs.size());
+    // Threads are not created in excess of batches (so not for small blocks).
+    const auto threads = std::min(store_.archive_threads(),
+        system::ceilinged_divide(txs.size(), archive_batch));
+    if (threads > one && is_distinct(txs))
+        ec = set_code_parallel(links, txs, threads);
+    else
+        ec = set_code(links, txs, zero, txs.size());
+
+    if (ec)
+        return ec;
 
     using bytes = linkage<schema::size>::integer;
     const auto wire = system::possible_narrow_cast<bytes>(size);
@@ -992,6 +1051,101 @@ code CLASS::set_code(txs_link& out_fk, const transactions& txs,
     // ========================================================================
 }
 
+TEMPLATE
+code CLASS::set_code(tx_links& out_fks, const transactions& txs,
+    size_t first, size_t last) NOEXCEPT
+{
+    BC_ASSERT(first <= last && last <= txs.size() && last <= out_fks.size());
+
+    const auto begin = std::next(txs.begin(), first);
+    const auto end = std::next(txs.begin(), last);
+
+    // Reserve input and output slabs for the range, allocated as one each.
+    // Slabs of previously archived txs are returned or left as padding.
+    // Slab sizes are computed once, for the reservation and for each link.
+    input_links ins_sizes{};
+    output_links outs_sizes{};
+    for (auto tx = begin; tx != end; ++tx)
+        push_sizes(ins_sizes, outs_sizes, **tx);
+
+    code ec{};
+    tx_link tx_fk{};
+    auto out_fk = std::next(out_fks.begin(), first);
+    input_arena inputs{ store_.input, std::accumulate(ins_sizes.begin(),
+        ins_sizes.end(), input_link::integer{}) };
+    output_arena outputs{ store_.output, std::accumulate(outs_sizes.begin(),
+        outs_sizes.end(), output_link::integer{}) };
+
+    std::span<const input_link::integer> ins{ ins_sizes };
+    std::span<const output_link::integer> outs{ outs_sizes };
+    for (auto tx = begin; tx != end; ++tx)
+    {
+        const auto ins_count = (*tx)->inputs_ptr()->size();
+        const auto outs_count = (*tx)->outputs_ptr()->size();
+        if ((ec = set_code(tx_fk, **tx, inputs, outputs,
+            ins.first(ins_count), outs.first(outs_count)))) return ec;
+
+        ins = ins.subspan(ins_count);
+        outs = outs.subspan(outs_count);
+        *out_fk++ = tx_fk.value;
+    }
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // Return any unused reservation (duplicate txs).
+    inputs.release();
+    outputs.release();
+    return error::success;
+    // ========================================================================
+}
+
+TEMPLATE
+code CLASS::set_code_parallel(tx_links& out_fks, const transactions& txs,
+    size_t threads) NOEXCEPT
+{
+    // Workers claim batches of txs, each archived with exact reservation.
+    // Batches are archived concurrently, so tx links increase within a batch
+    // but are not monotonic in block order. Only the txs slab is ordered.
+    constexpr auto batch = archive_batch;
+    std::atomic<size_t> next{};
+    std::atomic_bool fault{};
+    std::vector<code> codes(threads);
+
+    const auto work = [&](code& out) NOEXCEPT
+    {
+        size_t first{};
+        while (!fault.load() && (first = next.fetch_add(batch)) < txs.size())
+        {
+            const auto last = std::min(first + batch, txs.size());
+            if ((out = set_code(out_fks, txs, first, last)))
+                fault.store(true);
+        }
+    };
+
+    // The calling thread is the first worker. Batches are claimed, so if a
+    // thread cannot be created the remaining work falls to existing workers.
+    std::vector<std::thread> workers{};
+    try
+    {
+        workers.reserve(sub1(threads));
+        for (auto it = std::next(codes.begin()); it != codes.end(); ++it)
+            workers.emplace_back(work, std::ref(*it));
+    }
+    catch (const std::exception&)
+    {
+    }
+
+    work(codes.front());
+    for (auto& worker: workers)
+        worker.join();
+
+    const auto ec = std::find_if(codes.begin(), codes.end(),
+        [](const code& value) NOEXCEPT { return bool(value); });
+
+    return ec == codes.end() ? error::success : *ec;
+}
+
 TEMPLATE
 bool CLASS::set_dissasociated(const header_link& key) NOEXCEPT
 {
@@ -1015,6 +1169,30 @@ bool CLASS::set_dissasociated(const header_link& key) NOEXCEPT
     // ========================================================================
 }
 
+// private/static
+TEMPLATE
+inline bool CLASS::is_distinct(const transactions& txs) NOEXCEPT
+{
+    std_vector<hash_digest> hashes{};
+    hashes.reserve(txs.size());
+    for (const auto& tx: txs)
+        hashes.push_back(tx->hash(false));
+
+    std::sort(hashes.begin(), hashes.end());
+    return std::adjacent_find(hashes.begin(), hashes.end()) == hashes.end();
+}
+
+TEMPLATE
+inline void CLASS::push_sizes(input_links& ins_sizes,
+    output_links& outs_sizes, const transaction& tx) NOEXCEPT
+{
+    for (const auto& in: *tx.inputs_ptr())
+        ins_sizes.push_back(table::input::put_ref{ {}, *in }.count());
+
+    for (const auto& out: *tx.outputs_ptr())
+        outs_sizes.push_back(table::output::put_ref{ {}, {}, *out }.count());
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -20,6 +20,10 @@
 #define LIBBITCOIN_DATABASE_QUERY_CONFIRM_IPP
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
 #include <bitcoin/system.hpp>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/error.hpp>
@@ -258,32 +262,6 @@ inline error::error_t CLASS::spent_prevout(const foreign_point& point,
     return error::success;
 }
 
-// protected
-TEMPLATE
-inline error::error_t CLASS::unspendable_prevout(const point_link& link,
-    uint32_t sequence, uint32_t version, const context& ctx) const NOEXCEPT
-{
-    const auto strong = to_strong(get_point_key(link));
-    if (strong.block.is_terminal())
-        return strong.tx.is_terminal() ? error::missing_previous_output :
-            error::unconfirmed_spend;
-
-    context out{};
-    if (!get_context(out, strong.block))
-        return error::integrity;
-
-    if (is_coinbase(strong.tx) &&
-        !transaction::is_coinbase_mature(out.height, ctx.height))
-        return error::coinbase_maturity;
-
-    if (ctx.is_enabled(system::chain::flags::bip68_rule) &&
-        (version >= system::chain::relative_locktime_min_version) &&
-        input::is_locked(sequence, ctx.height, ctx.mtp, out.height, out.mtp))
-        return error::relative_time_locked;
-
-    return error::success;
-}
-
 TEMPLATE
 inline error::error_t CLASS::unspent_duplicates(const tx_link& link,
     const context& ctx) const NOEXCEPT
@@ -323,25 +301,177 @@ code CLASS::block_confirmable(const header_link& link) const NOEXCEPT
     if ((ec = unspent_duplicates(txs.front(), ctx)))
         return ec;
 
+    // Prevouts are resolved in block order, so the first error is preserved.
+    block_prevouts prevouts{};
+    if (!populate_prevouts(prevouts, txs))
+        return error::integrity;
+
+    // Threads are not created for small blocks, or in excess of batches.
+    const auto count = prevouts.size();
+    const auto batches = system::ceilinged_divide(count, confirm_batch);
+    const auto threads = count <= confirm_serial ? one :
+        std::min(store_.confirm_threads(), batches);
+    if (threads > one)
+        return block_confirmable_parallel(prevouts, ctx, threads);
+
+    for (const auto& prevout: prevouts)
+        if ((ec = prevout_confirmable(prevout, ctx)))
+            return ec;
+
+    return error::success;
+}
+
+// protected
+TEMPLATE
+bool CLASS::populate_prevouts(block_prevouts& out,
+    const tx_links& txs) const NOEXCEPT
+{
+    // Spends of all non-coinbase txs, with the prevout tx hash of each.
     uint32_t version{};
+    std_vector<hash_digest> hashes{};
     table::spend::get_prevout_sequence spend{};
     for (auto tx = std::next(txs.begin()); tx != txs.end(); ++tx)
     {
         for (const auto& spend_fk: to_tx_spends(version, *tx))
         {
             if (!store_.spend.get(spend_fk, spend))
-                return error::integrity;
+                return false;
 
-            if ((ec = unspendable_prevout(spend.point_fk, spend.sequence,
-                version, ctx)))
-                return ec;
+            hashes.push_back(get_point_key(spend.point_fk));
+            out.push_back({ spend.prevout(), *tx, spend.sequence, version });
+        }
+    }
+
+    // Each distinct prevout tx is found once, in one batched tx search.
+    auto distinct = hashes;
+    std::sort(distinct.begin(), distinct.end());
+    distinct.erase(std::unique(distinct.begin(), distinct.end()),
+        distinct.end());
+
+    std_vector<tx_link> links(distinct.size());
+    if (!store_.tx.first(distinct, links))
+        return false;
 
-            if ((ec = spent_prevout(spend.prevout(), *tx)))
-                return ec;
+    // Resolve strong block, context and coinbase of each distinct prevout tx.
+    // This is serial, as it walks once per distinct prevout tx (not spend).
+    block_prevouts resolved(distinct.size());
+    for (size_t index = 0; index < distinct.size(); ++index)
+    {
+        auto& prevout = resolved.at(index);
+        prevout.tx = links.at(index);
+        prevout.block = to_block(prevout.tx);
+
+        // Only a duplicated tx hash may be strong in other than first tx.
+        if (prevout.block.is_terminal() && !prevout.tx.is_terminal())
+        {
+            const auto strong = to_strong(distinct.at(index));
+            prevout.tx = strong.tx;
+            prevout.block = strong.block;
         }
+
+        if (prevout.block.is_terminal())
+            continue;
+
+        context ctx{};
+        if (!get_context(ctx, prevout.block))
+            return false;
+
+        prevout.height = ctx.height;
+        prevout.mtp = ctx.mtp;
+        prevout.coinbase = is_coinbase(prevout.tx);
     }
 
-    return error::success;
+    for (size_t index = 0; index < out.size(); ++index)
+    {
+        const auto& hash = hashes.at(index);
+        const auto it = std::lower_bound(distinct.begin(), distinct.end(), hash);
+        const auto& prevout = resolved.at(std::distance(distinct.begin(), it));
+        auto& spender = out.at(index);
+        spender.tx = prevout.tx;
+        spender.block = prevout.block;
+        spender.height = prevout.height;
+        spender.mtp = prevout.mtp;
+        spender.coinbase = prevout.coinbase;
+    }
+
+    return true;
+}
+
+// protected
+TEMPLATE
+inline error::error_t CLASS::prevout_confirmable(const block_prevout& prevout,
+    const context& ctx) const NOEXCEPT
+{
+    if (prevout.block.is_terminal())
+        return prevout.tx.is_terminal() ? error::missing_previous_output :
+            error::unconfirmed_spend;
+
+    if (prevout.coinbase &&
+        !transaction::is_coinbase_mature(prevout.height, ctx.height))
+        return error::coinbase_maturity;
+
+    if (ctx.is_enabled(system::chain::flags::bip68_rule) &&
+        (prevout.version >= system::chain::relative_locktime_min_version) &&
+        input::is_locked(prevout.sequence, ctx.height, ctx.mtp, prevout.height,
+            prevout.mtp))
+        return error::relative_time_locked;
+
+    return spent_prevout(prevout.key, prevout.parent);
+}
+
+// protected
+TEMPLATE
+code CLASS::block_confirmable_parallel(const block_prevouts& prevouts,
+    const context& ctx, size_t threads) const NOEXCEPT
+{
+    // Workers claim batches of prevouts and skip any beyond the lowest failed
+    // index, which is returned, so the result matches serial confirmation.
+    constexpr auto batch = confirm_batch;
+    const auto count = prevouts.size();
+    std::atomic<size_t> next{};
+    std::atomic<size_t> failed{ count };
+    std::vector<error::error_t> codes(count, error::success);
+
+    const auto fail = [&](size_t index) NOEXCEPT
+    {
+        auto lowest = failed.load();
+        while (index < lowest && !failed.compare_exchange_weak(lowest, index));
+    };
+
+    const auto work = [&]() NOEXCEPT
+    {
+        size_t first{};
+        while ((first = next.fetch_add(batch)) < failed.load())
+        {
+            const auto last = std::min(first + batch, count);
+            for (auto index = first; index < last && index < failed.load();
+                ++index)
+            {
+                if ((codes[index] = prevout_confirmable(prevouts[index], ctx)))
+                    fail(index);
+            }
+        }
+    };
+
+    // The calling thread is the first worker. Batches are claimed, so if a
+    // thread cannot be created the remaining work falls to existing workers.
+    std::vector<std::thread> workers{};
+    try
+    {
+        workers.reserve(sub1(threads));
+        for (size_t worker = one; worker < threads; ++worker)
+            workers.emplace_back(work);
+    }
+    catch (const std::exception&)
+    {
+    }
+
+    work();
+    for (auto& worker: workers)
+        worker.join();
+
+    const auto lowest = failed.load();
+    return lowest == count ? error::success : codes[lowest];
 }
 
 TEMPLATE
@@ -418,7 +548,12 @@ bool CLASS::push_candidate(const header_link& link) NOEXCEPT
 
     // Clean single allocation failure (e.g. disk full).
     const table::height::record candidate{ {}, link };
-    return store_.candidate.put(candidate);
+    const auto height = store_.candidate.put_link(candidate);
+    if (height.is_terminal())
+        return false;
+
+    push_window(link, height);
+    return true;
     // ========================================================================
 }
 
@@ -446,7 +581,11 @@ bool CLASS::pop_candidate() NOEXCEPT
     const auto scope = store_.get_transactor();
 
     // Clean single allocation failure (e.g. disk full).
-    return store_.candidate.truncate(top);
+    if (!store_.candidate.truncate(top))
+        return false;
+
+    pop_window(top);
+    return true;
     // ========================================================================
 }
 
@@ -466,76 +605,6 @@ bool CLASS::pop_confirmed() NOEXCEPT
     // ========================================================================
 }
 
-////// TEMP: testing cached values for confirmation.
-////struct cached_point
-////{
-////    // input (under validation)
-////    foreign_point key; // double-spendness
-////    uint32_t parent;   // input.parent
-////    uint32_t sequence; // bip68
-////
-////    // input->prevout
-////    uint32_t tx;       // confirmedness
-////    uint32_t height;   // bip68/maturity
-////    uint32_t mtp;      // bip68
-////    bool coinbase;     // maturity
-////};
-////// coinbase aligns at 4 bytes on msvc x64.
-////////static_assert(sizeof(cached_point) == 32u);
-////using cached_points = std_vector<cached_point>;
-////bool create_cached_points(cached_points& out,
-////    const header_link& link) const NOEXCEPT;
-////TEMPLATE
-////code CLASS::point_confirmable(const cached_point& point) const NOEXCEPT
-////{
-////    code ec{ error::success };
-////
-////    // height is always needed for coinbase (maturity).
-////    // sequence value tells which is needed, height or mtp (bip68).
-////    // but both may apply, so need to allow for two (no flags at prevout).
-////    const context ctx{ 0, point.height, point.mtp };
-////    if ((ec = unspendable_prevout(point.tx, point.coinbase, point.sequence, ctx)))
-////        return ec;
-////
-////    // may only be strong-spent by self (and must be but is not checked).
-////    if (spent_prevout(point.key, point.parent))
-////        return error::confirmed_double_spend;
-////
-////    return ec;
-////}
-////
-////TEMPLATE
-////bool CLASS::create_cached_points(cached_points& out,
-////    const header_link& link) const NOEXCEPT
-////{
-////    context ctx{};
-////    if (!get_context(ctx, link))
-////        return false;
-////
-////    table::input::get_prevout_sequence input{};
-////    for (const auto& in: to_non_coinbase_inputs(link))
-////    {
-////        if (!store_.input.get(in, input))
-////            return false;
-////    
-////        out.emplace_back
-////        (
-////            // input (under validation)
-////            input.prevout(),
-////            input.parent_fk,
-////            input.sequence,
-////
-////            // input->prevout
-////            to_tx(get_point_key(input.point_fk)),
-////            system::possible_narrow_cast<uint32_t>(ctx.height),
-////            ctx.mtp,
-////            is_coinbase(spent_fk)
-////        );
-////    }
-////
-////    return true;
-////}
-
 } // namespace database
 } // namespace libbitcoin
 
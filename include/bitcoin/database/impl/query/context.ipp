@@ -19,7 +19,10 @@
 #ifndef LIBBITCOIN_DATABASE_QUERY_CONTEXT_IPP
 #define LIBBITCOIN_DATABASE_QUERY_CONTEXT_IPP
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <bitcoin/system.hpp>
 #include <bitcoin/database/define.hpp>
 
@@ -96,10 +99,8 @@ bool CLASS::populate_retarget(chain_state::data& data,
     if (map.timestamp_retarget > data.height)
         return false;
 
-    for (auto it = map.timestamp_retarget; it < data.height; ++it)
-        link = to_parent(link);
-
-    return get_timestamp(data.timestamp.retarget, link);
+    return get_timestamp(data.timestamp.retarget,
+        to_ancestor(link, map.timestamp_retarget));
 }
 
 TEMPLATE
@@ -122,24 +123,30 @@ bool CLASS::populate_hashes(chain_state::data& data,
 }
 
 TEMPLATE
-bool CLASS::populate_work(chain_state::data& data,
-    header_link link) const NOEXCEPT
+bool CLASS::populate_hashes(chain_state::data& data,
+    const chain_state::map& map, const header_link& link) const NOEXCEPT
 {
-    uint256_t work{};
-    data.cumulative_work = work;
+    if (map.bip30_deactivate_height != chain_state::map::unrequested)
+        data.bip30_deactivate_hash = get_header_key(
+            to_ancestor(link, map.bip30_deactivate_height));
 
-    // This may scan the entire chain.
-    while (get_work(work, link))
-    {
-        data.cumulative_work += work;
-        link = to_parent(link);
+    if (map.bip9_bit0_height != chain_state::map::unrequested)
+        data.bip9_bit0_hash = get_header_key(
+            to_ancestor(link, map.bip9_bit0_height));
 
-        // Genesis parent link is terminal.
-        if (link.is_terminal())
-            return true;
-    }
+    if (map.bip9_bit1_height != chain_state::map::unrequested)
+        data.bip9_bit1_hash = get_header_key(
+            to_ancestor(link, map.bip9_bit1_height));
+
+    return true;
+}
 
-    return false;
+TEMPLATE
+bool CLASS::populate_work(chain_state::data& data,
+    header_link link) const NOEXCEPT
+{
+    // Cumulative work is stored with each header.
+    return get_cumulative_work(data.cumulative_work, link);
 }
 
 TEMPLATE
@@ -157,7 +164,7 @@ bool CLASS::populate_all(chain_state::data& data,
         populate_versions(data, map, link) &&
         populate_timestamps(data, map, link) &&
         populate_retarget(data, map, link) &&
-        populate_hashes(data, map) &&
+        populate_hashes(data, map, link) &&
         populate_work(data, link);
 }
 
@@ -193,9 +200,21 @@ bool CLASS::populate_candidate_bits(chain_state::data& data,
     data.bits.ordered.resize(map.bits.count);
     auto height = map.bits.high - map.bits.count;
 
-    for (auto& bit: data.bits.ordered)
-        if (!get_bits(bit, to_candidate(++height)))
-            return false;
+    window_entries window{};
+    if (get_window(window, add1(height), map.bits.count))
+    {
+        std::transform(window.begin(), window.end(),
+            data.bits.ordered.begin(), [](const auto& entry) NOEXCEPT
+            {
+                return entry.bits;
+            });
+    }
+    else
+    {
+        for (auto& bit: data.bits.ordered)
+            if (!get_bits(bit, to_candidate(++height)))
+                return false;
+    }
 
     data.bits.self = header.bits();
     return true;
@@ -208,9 +227,21 @@ bool CLASS::populate_candidate_versions(chain_state::data& data,
     data.version.ordered.resize(map.version.count);
     auto height = map.version.high - map.version.count;
 
-    for (auto& version: data.version.ordered)
-        if (!get_version(version, to_candidate(++height)))
-            return false;
+    window_entries window{};
+    if (get_window(window, add1(height), map.version.count))
+    {
+        std::transform(window.begin(), window.end(),
+            data.version.ordered.begin(), [](const auto& entry) NOEXCEPT
+            {
+                return entry.version;
+            });
+    }
+    else
+    {
+        for (auto& version: data.version.ordered)
+            if (!get_version(version, to_candidate(++height)))
+                return false;
+    }
 
     data.version.self = header.version();
     return true;
@@ -223,9 +254,21 @@ bool CLASS::populate_candidate_timestamps(chain_state::data& data,
     data.timestamp.ordered.resize(map.timestamp.count);
     auto height = map.timestamp.high - map.timestamp.count;
 
-    for (auto& timestamp: data.timestamp.ordered)
-        if (!get_timestamp(timestamp, to_candidate(++height)))
-            return false;
+    window_entries window{};
+    if (get_window(window, add1(height), map.timestamp.count))
+    {
+        std::transform(window.begin(), window.end(),
+            data.timestamp.ordered.begin(), [](const auto& entry) NOEXCEPT
+            {
+                return entry.timestamp;
+            });
+    }
+    else
+    {
+        for (auto& timestamp: data.timestamp.ordered)
+            if (!get_timestamp(timestamp, to_candidate(++height)))
+                return false;
+    }
 
     data.timestamp.self = header.timestamp();
     return true;
@@ -255,15 +298,12 @@ TEMPLATE
 bool CLASS::populate_candidate_work(chain_state::data& data,
     const header& header) const NOEXCEPT
 {
-    uint256_t work{};
-    data.cumulative_work = work;
-
-    // This may scan the entire chain.
-    for (auto height = zero; height < data.height; ++height)
-        if (get_work(work, to_candidate(height)))
-            data.cumulative_work += work;
-        else
-            return false;
+    data.cumulative_work = {};
+
+    // Cumulative work is stored with each (candidate parent) header.
+    if (!is_zero(data.height) && !get_cumulative_work(data.cumulative_work,
+        to_candidate(sub1(data.height))))
+        return false;
 
     data.cumulative_work += header.proof();
     return true;
@@ -288,6 +328,139 @@ bool CLASS::populate_candidate_all(chain_state::data& data,
         populate_hashes(data, map);
 }
 
+// Candidate window.
+// ----------------------------------------------------------------------------
+
+// protected
+TEMPLATE
+bool CLASS::get_window(window_entries& out, size_t first,
+    size_t count) const NOEXCEPT
+{
+    out.clear();
+    if (is_zero(count))
+        return true;
+
+    // The window is used only if its top is the candidate top, which implies
+    // that all of its entries are current (candidates form a chain).
+    const auto last = first + count;
+    const auto top = get_top_candidate();
+    const auto top_fk = to_candidate(top);
+    if (top_fk.is_terminal())
+        return false;
+
+    {
+        std::shared_lock lock{ window_mutex_ };
+        if (is_current(top, top_fk) && (first >= window_start_) &&
+            (last <= window_start_ + window_.size()))
+        {
+            const auto begin = std::next(window_.begin(), first - window_start_);
+            out.assign(begin, std::next(begin, count));
+            return true;
+        }
+    }
+
+    std::unique_lock lock{ window_mutex_ };
+    if (!is_current(top, top_fk))
+    {
+        // Keep the current part of the window (e.g. below another query's
+        // pushes), otherwise discard it (e.g. popped or reorganized).
+        while (!window_.empty())
+        {
+            const auto end = window_start_ + window_.size();
+            if ((end <= add1(top)) &&
+                (to_candidate(sub1(end)) == window_.back().link))
+                break;
+
+            window_.pop_back();
+        }
+    }
+
+    // Warm the window from first (or its current start) to the candidate top.
+    auto start = window_.empty() ? first : std::min(first, window_start_);
+    if (add1(top) - start > window_limit)
+    {
+        window_.clear();
+        start = first;
+    }
+
+    if ((last > add1(top)) || (add1(top) - start > window_limit))
+        return false;
+
+    if (window_.empty() || (start < window_start_))
+    {
+        window_.clear();
+        window_start_ = start;
+    }
+
+    table::header::get_window header{};
+    for (auto height = window_start_ + window_.size(); height <= top; ++height)
+    {
+        const auto link = to_candidate(height);
+        if (!store_.header.get(link, header))
+        {
+            window_.clear();
+            return false;
+        }
+
+        window_.push_back({ link, header.bits, header.version,
+            header.timestamp });
+    }
+
+    // Confirm the window was not raced by a candidate change.
+    if (!is_current(top, top_fk))
+    {
+        window_.clear();
+        return false;
+    }
+
+    const auto begin = std::next(window_.begin(), first - window_start_);
+    out.assign(begin, std::next(begin, count));
+    return true;
+}
+
+// protected
+TEMPLATE
+bool CLASS::is_current(size_t top, const header_link& top_fk) const NOEXCEPT
+{
+    return !window_.empty() && (window_start_ + window_.size() == add1(top)) &&
+        (window_.back().link == top_fk) && (to_candidate(top) == top_fk);
+}
+
+// protected
+TEMPLATE
+void CLASS::push_window(const header_link& link, size_t height) NOEXCEPT
+{
+    table::header::get_window header{};
+    const auto found = store_.header.get(link, header);
+
+    // An empty window is warmed on next use.
+    std::unique_lock lock{ window_mutex_ };
+    if (!found || window_.empty() ||
+        (window_start_ + window_.size() != height))
+    {
+        window_.clear();
+        return;
+    }
+
+    window_.push_back({ link, header.bits, header.version, header.timestamp });
+    if (window_.size() > window_limit)
+    {
+        window_.pop_front();
+        ++window_start_;
+    }
+}
+
+// protected
+TEMPLATE
+void CLASS::pop_window(size_t height) NOEXCEPT
+{
+    std::unique_lock lock{ window_mutex_ };
+    if (!window_.empty() && (window_start_ + window_.size() == add1(height)))
+        window_.pop_back();
+    else
+        window_.clear();
+}
+
 TEMPLATE
 typename CLASS::chain_state_ptr CLASS::get_candidate_chain_state(
     const system::settings& settings) const NOEXCEPT
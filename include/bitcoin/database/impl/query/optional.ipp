@@ -35,7 +35,7 @@ TEMPLATE
 bool CLASS::get_confirmed_balance(uint64_t& out,
     const hash_digest& key) const NOEXCEPT
 {
-    auto it = store_.address.it(key);
+    auto it = store_.address.find(key);
     if (it.self().is_terminal())
         return false;
 
@@ -65,7 +65,7 @@ TEMPLATE
 bool CLASS::to_address_outputs(output_links& out,
     const hash_digest& key) const NOEXCEPT
 {
-    auto it = store_.address.it(key);
+    auto it = store_.address.find(key);
     if (it.self().is_terminal())
         return false;
 
@@ -90,7 +90,7 @@ TEMPLATE
 bool CLASS::to_unspent_outputs(output_links& out,
     const hash_digest& key) const NOEXCEPT
 {
-    auto it = store_.address.it(key);
+    auto it = store_.address.find(key);
     if (it.self().is_terminal())
         return {};
 
@@ -116,7 +116,7 @@ TEMPLATE
 bool CLASS::to_minimum_unspent_outputs(output_links& out,
     const hash_digest& key, uint64_t minimum) const NOEXCEPT
 {
-    auto it = store_.address.it(key);
+    auto it = store_.address.find(key);
     if (it.self().is_terminal())
         return {};
 
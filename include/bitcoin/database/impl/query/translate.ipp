@@ -187,6 +187,41 @@ header_link CLASS::to_parent(const header_link& link) const NOEXCEPT
     return header.parent_fk;
 }
 
+// Skip list traversal, as bitcoin core CBlockIndex::GetAncestor (pskip).
+TEMPLATE
+header_link CLASS::to_ancestor(const header_link& link,
+    size_t height) const NOEXCEPT
+{
+    table::header::get_ancestry header{};
+    if (!store_.header.get(link, header) || (header.height < height))
+        return {};
+
+    auto walk = link;
+    size_t position = header.height;
+    while (position > height)
+    {
+        // Take the skip unless it overshoots, or its parent skip is better.
+        const auto skip = to_skip_height(position);
+        const auto prior = to_skip_height(sub1(position));
+        if (!header_link{ header.skip_fk }.is_terminal() && ((skip == height) ||
+            ((skip > height) && !((prior + two < skip) && (prior >= height)))))
+        {
+            walk = header.skip_fk;
+            position = skip;
+        }
+        else
+        {
+            walk = header.parent_fk;
+            --position;
+        }
+
+        if ((position > height) && !store_.header.get(walk, header))
+            return {};
+    }
+
+    return walk;
+}
+
 TEMPLATE
 header_link CLASS::to_block(const tx_link& link) const NOEXCEPT
 {
@@ -262,6 +297,25 @@ inline header_links CLASS::to_blocks(const tx_link& link) const NOEXCEPT
     return strong_only(strongs);
 }
 
+// private/static
+// Bitcoin core GetSkipHeight.
+TEMPLATE
+constexpr size_t CLASS::to_skip_height(size_t height) NOEXCEPT
+{
+    constexpr auto invert_lowest_one = [](size_t value) NOEXCEPT
+    {
+        return value & sub1(value);
+    };
+
+    if (height < two)
+        return zero;
+
+    // Odd heights skip to a lower even height, balancing both step sizes.
+    return is_odd(height) ?
+        add1(invert_lowest_one(invert_lowest_one(sub1(height)))) :
+        invert_lowest_one(height);
+}
+
 // private/static
 TEMPLATE
 inline bool CLASS::contains(const block_txs& blocks,
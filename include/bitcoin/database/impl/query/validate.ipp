@@ -144,6 +144,18 @@ bool CLASS::get_work(uint256_t& work, const header_link& link) const NOEXCEPT
     return result;
 }
 
+TEMPLATE
+bool CLASS::get_cumulative_work(uint256_t& work,
+    const header_link& link) const NOEXCEPT
+{
+    table::header::get_work header{};
+    if (!store_.header.get(link, header))
+        return false;
+
+    work = system::to_uint256(header.work);
+    return true;
+}
+
 ////TEMPLATE
 ////bool CLASS::get_check_context(context& ctx, hash_digest& hash,
 ////    uint32_t& timestamp, const header_link& link) const NOEXCEPT
@@ -20,7 +20,13 @@
 #define LIBBITCOIN_DATABASE_STORE_IPP
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <chrono>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
 #include <bitcoin/system.hpp>
 #include <bitcoin/database/boost.hpp>
 #include <bitcoin/database/define.hpp>
@@ -37,6 +43,14 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 // so establish 1 as the minimum value (which also implies disabled).
 constexpr auto nonzero = 1_u32;
 
+// Power of two bucket counts are indexed by mask (see head).
+constexpr uint32_t to_buckets(uint32_t buckets, bool power2) NOEXCEPT
+{
+    const auto value = std::max(buckets, nonzero);
+    return power2 && value <= system::power2<uint32_t>(31u) ?
+        std::bit_ceil(value) : value;
+}
+
 // public
 // ----------------------------------------------------------------------------
 
@@ -53,13 +67,16 @@ const std::unordered_map<event_t, std::string> CLASS::events
     { event_t::close_table, "close_table" },
 
     { event_t::wait_lock, "wait_lock" },
+    { event_t::writeback_body, "writeback_body" },
     { event_t::flush_body, "flush_body" },
     { event_t::backup_table, "backup_table" },
     { event_t::copy_header, "copy_header" },
     { event_t::archive_snapshot, "archive_snapshot" },
 
     { event_t::restore_table, "restore_table" },
-    { event_t::recover_snapshot, "recover_snapshot" }
+    { event_t::recover_snapshot, "recover_snapshot" },
+
+    { event_t::rebuild_table, "rebuild_table" }
 };
 
 TEMPLATE
@@ -128,79 +145,79 @@ CLASS::store(const settings& config) NOEXCEPT
 
     // Archive.
 
-    header_head_(head(config.path / schema::dir::heads, schema::archive::header)),
-    header_body_(body(config.path, schema::archive::header), config.header_size, config.header_rate),
-    header(header_head_, header_body_, std::max(config.header_buckets, nonzero)),
+    header_head_(head(config.path / schema::dir::heads, schema::archive::header), one, zero, zero, config.head_advice, config.anonymous_heads),
+    header_body_(body(config.path, schema::archive::header), config.header_size, config.header_rate, config.reservation, config.header_advice),
+    header(header_head_, header_body_, to_buckets(config.header_buckets, config.power2_buckets), config.rehash_load),
 
-    input_head_(head(config.path / schema::dir::heads, schema::archive::input)),
-    input_body_(body(config.path, schema::archive::input), config.input_size, config.input_rate),
+    input_head_(head(config.path / schema::dir::heads, schema::archive::input), one, zero, zero, config.head_advice, config.anonymous_heads),
+    input_body_(body(config.path, schema::archive::input), config.input_size, config.input_rate, config.reservation, config.input_advice),
     input(input_head_, input_body_),
 
-    output_head_(head(config.path / schema::dir::heads, schema::archive::output)),
-    output_body_(body(config.path, schema::archive::output), config.output_size, config.output_rate),
+    output_head_(head(config.path / schema::dir::heads, schema::archive::output), one, zero, zero, config.head_advice, config.anonymous_heads),
+    output_body_(body(config.path, schema::archive::output), config.output_size, config.output_rate, config.reservation, config.output_advice),
     output(output_head_, output_body_),
 
-    point_head_(head(config.path / schema::dir::heads, schema::archive::point)),
-    point_body_(body(config.path, schema::archive::point), config.point_size, config.point_rate),
-    point(point_head_, point_body_, std::max(config.point_buckets, nonzero)),
+    point_head_(head(config.path / schema::dir::heads, schema::archive::point), one, zero, zero, config.head_advice, config.anonymous_heads),
+    point_body_(body(config.path, schema::archive::point), config.point_size, config.point_rate, config.reservation, config.point_advice),
+    point(point_head_, point_body_, to_buckets(config.point_buckets, config.power2_buckets), config.rehash_load, config.point_filter, config.fingerprint_heads),
 
-    puts_head_(head(config.path / schema::dir::heads, schema::archive::puts)),
-    puts_body_(body(config.path, schema::archive::puts), config.puts_size, config.puts_rate),
+    puts_head_(head(config.path / schema::dir::heads, schema::archive::puts), one, zero, zero, config.head_advice, config.anonymous_heads),
+    puts_body_(body(config.path, schema::archive::puts), config.puts_size, config.puts_rate, config.reservation, config.puts_advice),
     puts(puts_head_, puts_body_),
 
-    spend_head_(head(config.path / schema::dir::heads, schema::archive::spend)),
-    spend_body_(body(config.path, schema::archive::spend), config.spend_size, config.spend_rate),
-    spend(spend_head_, spend_body_, std::max(config.spend_buckets, nonzero)),
+    spend_head_(head(config.path / schema::dir::heads, schema::archive::spend), one, zero, zero, config.head_advice, config.anonymous_heads),
+    spend_body_(body(config.path, schema::archive::spend), config.spend_size, config.spend_rate, config.reservation, config.spend_advice),
+    spend(spend_head_, spend_body_, to_buckets(config.spend_buckets, config.power2_buckets), config.rehash_load),
 
-    tx_head_(head(config.path / schema::dir::heads, schema::archive::tx)),
-    tx_body_(body(config.path, schema::archive::tx), config.tx_size, config.tx_rate),
-    tx(tx_head_, tx_body_, std::max(config.tx_buckets, nonzero)),
+    tx_head_(head(config.path / schema::dir::heads, schema::archive::tx), one, zero, zero, config.head_advice, config.anonymous_heads),
+    tx_body_(body(config.path, schema::archive::tx), config.tx_size, config.tx_rate, config.reservation, config.tx_advice),
+    tx(tx_head_, tx_body_, to_buckets(config.tx_buckets, config.power2_buckets), config.rehash_load, config.tx_filter, config.fingerprint_heads),
 
-    txs_head_(head(config.path / schema::dir::heads, schema::archive::txs)),
-    txs_body_(body(config.path, schema::archive::txs), config.txs_size, config.txs_rate),
-    txs(txs_head_, txs_body_, std::max(config.txs_buckets, nonzero)),
+    txs_head_(head(config.path / schema::dir::heads, schema::archive::txs), one, zero, zero, config.head_advice, config.anonymous_heads),
+    txs_body_(body(config.path, schema::archive::txs), config.txs_size, config.txs_rate, config.reservation, config.txs_advice),
+    txs(txs_head_, txs_body_, to_buckets(config.txs_buckets, config.power2_buckets), config.rehash_load),
 
     // Indexes.
 
-    candidate_head_(head(config.path / schema::dir::heads, schema::indexes::candidate)),
-    candidate_body_(body(config.path, schema::indexes::candidate), config.candidate_size, config.candidate_rate),
+    candidate_head_(head(config.path / schema::dir::heads, schema::indexes::candidate), one, zero, zero, config.head_advice, config.anonymous_heads),
+    candidate_body_(body(config.path, schema::indexes::candidate), config.candidate_size, config.candidate_rate, config.reservation, config.candidate_advice),
     candidate(candidate_head_, candidate_body_),
 
-    confirmed_head_(head(config.path / schema::dir::heads, schema::indexes::confirmed)),
-    confirmed_body_(body(config.path, schema::indexes::confirmed), config.confirmed_size, config.confirmed_rate),
+    confirmed_head_(head(config.path / schema::dir::heads, schema::indexes::confirmed), one, zero, zero, config.head_advice, config.anonymous_heads),
+    confirmed_body_(body(config.path, schema::indexes::confirmed), config.confirmed_size, config.confirmed_rate, config.reservation, config.confirmed_advice),
     confirmed(confirmed_head_, confirmed_body_),
 
-    strong_tx_head_(head(config.path / schema::dir::heads, schema::indexes::strong_tx)),
-    strong_tx_body_(body(config.path, schema::indexes::strong_tx), config.strong_tx_size, config.strong_tx_rate),
-    strong_tx(strong_tx_head_, strong_tx_body_, std::max(config.strong_tx_buckets, nonzero)),
+    strong_tx_head_(head(config.path / schema::dir::heads, schema::indexes::strong_tx), one, zero, zero, config.head_advice, config.anonymous_heads),
+    strong_tx_body_(body(config.path, schema::indexes::strong_tx), config.strong_tx_size, config.strong_tx_rate, config.reservation, config.strong_tx_advice),
+    strong_tx(strong_tx_head_, strong_tx_body_, to_buckets(config.strong_tx_buckets, config.power2_buckets), config.rehash_load),
 
     // Caches.
 
-    validated_bk_head_(head(config.path / schema::dir::heads, schema::caches::validated_bk)),
-    validated_bk_body_(body(config.path, schema::caches::validated_bk), config.validated_bk_size, config.validated_bk_rate),
-    validated_bk(validated_bk_head_, validated_bk_body_, std::max(config.validated_bk_buckets, nonzero)),
+    validated_bk_head_(head(config.path / schema::dir::heads, schema::caches::validated_bk), one, zero, zero, config.head_advice, config.anonymous_heads),
+    validated_bk_body_(body(config.path, schema::caches::validated_bk), config.validated_bk_size, config.validated_bk_rate, config.reservation, config.validated_bk_advice),
+    validated_bk(validated_bk_head_, validated_bk_body_, to_buckets(config.validated_bk_buckets, config.power2_buckets), config.rehash_load),
 
-    validated_tx_head_(head(config.path / schema::dir::heads, schema::caches::validated_tx)),
-    validated_tx_body_(body(config.path, schema::caches::validated_tx), config.validated_tx_size, config.validated_tx_rate),
-    validated_tx(validated_tx_head_, validated_tx_body_, std::max(config.validated_tx_buckets, nonzero)),
+    validated_tx_head_(head(config.path / schema::dir::heads, schema::caches::validated_tx), one, zero, zero, config.head_advice, config.anonymous_heads),
+    validated_tx_body_(body(config.path, schema::caches::validated_tx), config.validated_tx_size, config.validated_tx_rate, config.reservation, config.validated_tx_advice),
+    validated_tx(validated_tx_head_, validated_tx_body_, to_buckets(config.validated_tx_buckets, config.power2_buckets), config.rehash_load),
 
     // Optionals.
 
-    address_head_(head(config.path / schema::dir::heads, schema::optionals::address)),
-    address_body_(body(config.path, schema::optionals::address), config.address_size, config.address_rate),
-    address(address_head_, address_body_, std::max(config.address_buckets, nonzero)),
+    address_head_(head(config.path / schema::dir::heads, schema::optionals::address), one, zero, zero, config.head_advice, config.anonymous_heads),
+    address_body_(body(config.path, schema::optionals::address), config.address_size, config.address_rate, config.reservation, config.address_advice),
+    address(address_head_, address_body_, to_buckets(config.address_buckets, config.power2_buckets), config.rehash_load, zero, config.fingerprint_heads),
 
-    neutrino_head_(head(config.path / schema::dir::heads, schema::optionals::neutrino)),
-    neutrino_body_(body(config.path, schema::optionals::neutrino), config.neutrino_size, config.neutrino_rate),
-    neutrino(neutrino_head_, neutrino_body_, std::max(config.neutrino_buckets, nonzero)),
+    neutrino_head_(head(config.path / schema::dir::heads, schema::optionals::neutrino), one, zero, zero, config.head_advice, config.anonymous_heads),
+    neutrino_body_(body(config.path, schema::optionals::neutrino), config.neutrino_size, config.neutrino_rate, config.reservation, config.neutrino_advice),
+    neutrino(neutrino_head_, neutrino_body_, to_buckets(config.neutrino_buckets, config.power2_buckets), config.rehash_load),
 
-    ////bootstrap_head_(head(config.path / schema::dir::heads, schema::optionals::bootstrap)),
-    ////bootstrap_body_(body(config.path, schema::optionals::bootstrap), config.bootstrap_size, config.bootstrap_rate),
+    ////bootstrap_head_(head(config.path / schema::dir::heads, schema::optionals::bootstrap), one, zero, zero, config.head_advice, config.anonymous_heads),
+    ////bootstrap_body_(body(config.path, schema::optionals::bootstrap), config.bootstrap_size, config.bootstrap_rate, config.reservation, config.bootstrap_advice),
     ////bootstrap(bootstrap_head_, bootstrap_body_),
 
-    ////buffer_head_(head(config.path / schema::dir::heads, schema::optionals::buffer)),
-    ////buffer_body_(body(config.path, schema::optionals::buffer), config.buffer_size, config.buffer_rate),
-    ////buffer(buffer_head_, buffer_body_, std::max(config.buffer_buckets, nonzero)),
+    ////buffer_head_(head(config.path / schema::dir::heads, schema::optionals::buffer), one, zero, zero, config.head_advice, config.anonymous_heads),
+    ////buffer_body_(body(config.path, schema::optionals::buffer), config.buffer_size, config.buffer_rate, config.reservation, config.buffer_advice),
+    ////buffer(buffer_head_, buffer_body_, to_buckets(config.buffer_buckets, config.power2_buckets), config.rehash_load),
 
     // Locks.
     flush_lock_(lock(config.path, schema::locks::flush)),
@@ -278,6 +295,8 @@ code CLASS::create(const event_handler& handler) NOEXCEPT
     ////create(ec, buffer_head_, table_t::buffer_head);
     ////create(ec, buffer_body_, table_t::buffer_body);
 
+    if (!ec) ec = write_version();
+
     const auto populate = [&handler](code& ec, auto& storage,
         table_t table) NOEXCEPT
     {
@@ -399,9 +418,53 @@ code CLASS::open(const event_handler& handler) NOEXCEPT
     return ec;
 }
 
+TEMPLATE
+code CLASS::writeback(const event_handler& handler) NOEXCEPT
+{
+    code ec{ error::success };
+    const auto writeback = [&handler](code& ec, auto& storage,
+        table_t table) NOEXCEPT
+    {
+        if (!ec)
+        {
+            handler(event_t::writeback_body, table);
+            ec = storage.writeback();
+        }
+    };
+
+    // Assumes/requires tables open/loaded.
+    writeback(ec, header_body_, table_t::header_body);
+    writeback(ec, input_body_, table_t::input_body);
+    writeback(ec, output_body_, table_t::output_body);
+    writeback(ec, point_body_, table_t::point_body);
+    writeback(ec, puts_body_, table_t::puts_body);
+    writeback(ec, spend_body_, table_t::spend_body);
+    writeback(ec, tx_body_, table_t::tx_body);
+    writeback(ec, txs_body_, table_t::txs_body);
+
+    writeback(ec, candidate_body_, table_t::candidate_body);
+    writeback(ec, confirmed_body_, table_t::confirmed_body);
+    writeback(ec, strong_tx_body_, table_t::strong_tx_body);
+
+    writeback(ec, validated_bk_body_, table_t::validated_bk_body);
+    writeback(ec, validated_tx_body_, table_t::validated_tx_body);
+
+    writeback(ec, address_body_, table_t::address_body);
+    writeback(ec, neutrino_body_, table_t::neutrino_body);
+    ////writeback(ec, bootstrap_body_, table_t::bootstrap_body);
+    ////writeback(ec, buffer_body_, table_t::buffer_body);
+
+    return ec;
+}
+
 TEMPLATE
 code CLASS::snapshot(const event_handler& handler) NOEXCEPT
 {
+    // Begin writeback before suspending writes, so that the flush (under
+    // exclusive lock) waits only on the remainder. Failure is not fatal, as
+    // the flush synchronizes all memory.
+    /* code */ writeback(handler);
+
     while (!transactor_mutex_.try_lock_for(std::chrono::seconds(1)))
     {
         handler(event_t::wait_lock, table_t::store);
@@ -569,10 +632,42 @@ code CLASS::close(const event_handler& handler) NOEXCEPT
 // protected
 // ----------------------------------------------------------------------------
 
+TEMPLATE
+code CLASS::write_version() const NOEXCEPT
+{
+    const auto bytes = system::to_little_endian(schema::version);
+    return file::create_file_ex(configuration_.path / schema::meta::version,
+        bytes.data(), bytes.size());
+}
+
+// A store without a version file predates versioning, so is incompatible.
+TEMPLATE
+code CLASS::check_version() const NOEXCEPT
+{
+    const auto filename = configuration_.path / schema::meta::version;
+    if (!file::is_file(filename))
+        return error::store_version;
+
+    int descriptor{ file::invalid };
+    if (file::open_ex(descriptor, filename))
+        return error::store_version;
+
+    std::array<uint8_t, sizeof(uint32_t)> bytes{};
+    const auto read = file::read(descriptor, bytes.data(), bytes.size());
+    if (!file::close(descriptor) || !read)
+        return error::store_version;
+
+    return system::from_little_endian<uint32_t>(bytes) == schema::version ?
+        error::success : error::store_version;
+}
+
 TEMPLATE
 code CLASS::open_load(const event_handler& handler) NOEXCEPT
 {
-    code ec{ error::success };
+    code ec{ check_version() };
+    if (ec)
+        return ec;
+
     const auto open = [&handler](code& ec, auto& storage, table_t table) NOEXCEPT
     {
         if (!ec)
@@ -1021,6 +1116,102 @@ code CLASS::restore(const event_handler& handler) NOEXCEPT
     return ec;
 }
 
+TEMPLATE
+code CLASS::rebuild(const event_handler& handler) NOEXCEPT
+{
+    if (!file::is_directory(configuration_.path))
+        return error::missing_directory;
+
+    if (!transactor_mutex_.try_lock())
+        return error::transactor_lock;
+
+    if (!process_lock_.try_lock())
+    {
+        transactor_mutex_.unlock();
+        return error::process_lock;
+    }
+
+    // Requires that the store is not flush locked (corrupted).
+    if (!flush_lock_.try_lock())
+    {
+        /* bool */ process_lock_.try_unlock();
+        transactor_mutex_.unlock();
+        return error::flush_lock;
+    }
+
+    auto ec = open_load(handler);
+    if (ec)
+    {
+        /* code */ unload_close(handler);
+
+        // unlock errors override ec.
+        if (!flush_lock_.try_unlock()) ec = error::flush_unlock;
+        if (!process_lock_.try_unlock()) ec = error::process_unlock;
+        transactor_mutex_.unlock();
+        return ec;
+    }
+
+    using job = std::pair<table_t, std::function<bool()>>;
+    std::vector<job> jobs{};
+    const auto add = [&jobs](auto& table, table_t id) NOEXCEPT
+    {
+        jobs.emplace_back(id, [&table]() NOEXCEPT { return table.rebuild(); });
+    };
+
+    add(header, table_t::header_table);
+    add(point, table_t::point_table);
+    add(spend, table_t::spend_table);
+    add(tx, table_t::tx_table);
+    add(txs, table_t::txs_table);
+
+    add(strong_tx, table_t::strong_tx_table);
+
+    add(validated_bk, table_t::validated_bk_table);
+    add(validated_tx, table_t::validated_tx_table);
+
+    add(address, table_t::address_table);
+    add(neutrino, table_t::neutrino_table);
+    ////add(buffer, table_t::buffer_table);
+
+    // Tables are independent, so each is rebuilt by its own worker.
+    std::vector<code> codes(jobs.size());
+    std::vector<std::thread> workers{};
+    workers.reserve(jobs.size());
+    for (size_t index{}; index < jobs.size(); ++index)
+    {
+        handler(event_t::rebuild_table, jobs.at(index).first);
+        workers.emplace_back([&jobs, &codes, index]() NOEXCEPT
+        {
+            if (!jobs.at(index).second())
+                codes.at(index) = error::rebuild_table;
+        });
+    }
+
+    for (auto& worker: workers)
+        worker.join();
+
+    const auto failed = std::find_if(codes.begin(), codes.end(),
+        [](const code& value) NOEXCEPT { return bool(value); });
+
+    // Prior snapshot heads have prior bucket counts, so are replaced.
+    ec = failed == codes.end() ? backup(handler) : *failed;
+
+    if (ec)
+    {
+        /* code */ unload_close(handler);
+
+        // unlock errors override ec.
+        // on failure flush_lock is left in place (store corrupt).
+        if (!process_lock_.try_unlock()) ec = error::process_unlock;
+        transactor_mutex_.unlock();
+        return ec;
+    }
+
+    // store is closed after successful rebuild, as from close().
+    transactor_mutex_.unlock();
+    return close(handler);
+}
+
 // context
 // ----------------------------------------------------------------------------
 
@@ -1030,6 +1221,18 @@ const typename CLASS::transactor CLASS::get_transactor() NOEXCEPT
     return transactor{ transactor_mutex_ };
 }
 
+TEMPLATE
+size_t CLASS::archive_threads() const NOEXCEPT
+{
+    return std::max<size_t>(configuration_.archive_threads, one);
+}
+
+TEMPLATE
+size_t CLASS::confirm_threads() const NOEXCEPT
+{
+    return std::max<size_t>(configuration_.confirm_threads, one);
+}
+
 TEMPLATE
 code CLASS::get_fault() const NOEXCEPT
 {
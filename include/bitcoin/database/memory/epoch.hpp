@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_EPOCH_HPP
+#define LIBBITCOIN_DATABASE_MEMORY_EPOCH_HPP
+
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/memory/striped_counter.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// One generation of a memory map, pinned by readers until drained.
+/// The memory and capacity are written only while the epoch is unpublished
+/// and drained, and read only while pinned.
+class BCD_API epoch
+  : public striped_counter
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(epoch);
+
+    epoch() NOEXCEPT;
+
+    /// Set mapped memory, epoch must be unpublished and drained.
+    void assign(uint8_t* memory, size_t capacity) NOEXCEPT;
+
+    /// The mapped memory (nullptr if none) and its capacity.
+    uint8_t* memory() const NOEXCEPT;
+    size_t capacity() const NOEXCEPT;
+
+private:
+    uint8_t* memory_{};
+    size_t capacity_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
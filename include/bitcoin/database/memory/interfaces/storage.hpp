@@ -23,6 +23,7 @@
 #include <bitcoin/system.hpp>
 #include <bitcoin/system.hpp>
 #include <bitcoin/database/define.hpp>
+#include <bitcoin/database/memory/advice.hpp>
 #include <bitcoin/database/memory/interfaces/memory.hpp>
 
 namespace libbitcoin {
@@ -49,6 +50,9 @@ public:
     /// Flush memory map to disk, suspend writes for call, must be loaded.
     virtual code flush() NOEXCEPT = 0;
 
+    /// Begin writeback of appended memory, writes continue, must be loaded.
+    virtual code writeback() NOEXCEPT = 0;
+
     /// Flush, unmap and truncate to logical, restartable, idempotent.
     virtual code unload() NOEXCEPT = 0;
 
@@ -67,9 +71,21 @@ public:
     /// Allocate bytes and return offset to first allocated (or eof).
     virtual size_t allocate(size_t chunk) NOEXCEPT = 0;
 
+    /// Return allocated bytes to storage, false if not at end of logical.
+    virtual bool deallocate(size_t offset, size_t chunk) NOEXCEPT = 0;
+
     /// Get r/w access to start/offset of memory map (or null).
     virtual memory_ptr get(size_t offset=zero) const NOEXCEPT = 0;
 
+    /// Copy size bytes at offset, false if beyond logical (or not loaded).
+    /// Memory is held only for the copy, no memory object is allocated.
+    virtual bool copy(uint8_t* to, size_t offset,
+        size_t size) const NOEXCEPT = 0;
+
+    /// Advise expected access of offset range (false if not loaded/failed).
+    virtual bool advise(size_t offset, size_t length,
+        advice_t advice) const NOEXCEPT = 0;
+
     /// Get the fault condition.
     virtual code get_fault() const NOEXCEPT = 0;
 
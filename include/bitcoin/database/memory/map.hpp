@@ -20,6 +20,7 @@
 #define LIBBITCOIN_DATABASE_MEMORY_MAP_HPP
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <filesystem>
 #include <mutex>
@@ -29,6 +30,7 @@
 #include <bitcoin/database/error.hpp>
 #include <bitcoin/database/file/file.hpp>
 #include <bitcoin/database/memory/accessor.hpp>
+#include <bitcoin/database/memory/epoch.hpp>
 #include <bitcoin/database/memory/interfaces/memory.hpp>
 #include <bitcoin/database/memory/interfaces/storage.hpp>
 
@@ -42,8 +44,19 @@ class BCD_API map
 public:
     DELETE_COPY_MOVE(map);
 
+    /// Nonzero reservation reserves virtual address space for the map, within
+    /// which it grows in place (without moving). Growth beyond reservation
+    /// falls back to remapping. Reservation is not supported on msvc.
+    /// Advice is applied to the full capacity upon each load and remap,
+    /// except for normal advice (default), which is not applied.
+    /// Anonymous backs the map with private (transparent huge page) memory,
+    /// read from the file at load and written back at flush and unload.
+    /// Anonymous memory reserves the greater of reservation and capacity plus
+    /// anonymous_reservation, within which it grows in place. Growth beyond
+    /// this copies the memory, waiting on readers. Not supported on msvc.
     map(const std::filesystem::path& filename, size_t minimum=1,
-        size_t expansion=0) NOEXCEPT;
+        size_t expansion=0, size_t reservation=0,
+        advice_t advice=advice_t::normal, bool anonymous=false) NOEXCEPT;
 
     /// Destruct for debug assertion only.
     virtual ~map() NOEXCEPT;
@@ -72,6 +85,11 @@ public:
     /// Flush memory map to disk, suspend writes for call, must be loaded.
     code flush() NOEXCEPT override;
 
+    /// Begin asynchronous writeback of memory appended since the prior
+    /// writeback or flush, writes continue, must be loaded. A subsequent
+    /// flush (barrier) then waits only upon the remainder.
+    code writeback() NOEXCEPT override;
+
     /// Flush, unmap and truncate to logical, restartable, idempotent.
     code unload() NOEXCEPT override;
 
@@ -90,9 +108,19 @@ public:
     /// Allocate bytes and return offset to first allocated (or eof).
     size_t allocate(size_t chunk) NOEXCEPT override;
 
+    /// Return allocated bytes to storage, false if not at end of logical.
+    bool deallocate(size_t offset, size_t chunk) NOEXCEPT override;
+
     /// Get r/w access to start/offset of memory map (or null).
     memory_ptr get(size_t offset=zero) const NOEXCEPT override;
 
+    /// Copy size bytes at offset, false if beyond logical (or not loaded).
+    bool copy(uint8_t* to, size_t offset, size_t size) const NOEXCEPT override;
+
+    /// Advise expected access of offset range (false if not loaded/failed).
+    bool advise(size_t offset, size_t length,
+        advice_t advice) const NOEXCEPT override;
+
     /// Get the fault condition.
     code get_fault() const NOEXCEPT override;
 
@@ -107,26 +135,48 @@ protected:
 
 private:
     using path = std::filesystem::path;
-    using access = accessor<std::shared_mutex>;
+    using access = accessor<epoch::stripe>;
+    static constexpr size_t epochs = 8;
+    static constexpr size_t anonymous_reservation = system::power2<size_t>(30u);
 
     // Mapping utilities.
     bool flush_() NOEXCEPT;
+    bool writeback_() NOEXCEPT;
     bool unmap_() NOEXCEPT;
     bool map_() NOEXCEPT;
     bool remap_(size_t size) NOEXCEPT;
     bool resize_(size_t size) NOEXCEPT;
+    bool extend_(size_t size) NOEXCEPT;
     bool finalize_(size_t size) NOEXCEPT;
+    bool advise_(size_t offset, size_t length, advice_t advice) const NOEXCEPT;
+
+    // Anonymous utilities.
+    uint8_t* allocate_(size_t size) NOEXCEPT;
+    bool read_() NOEXCEPT;
+    bool write_() NOEXCEPT;
+
+    // Epoch utilities.
+    void publish_(size_t size) NOEXCEPT;
+    void drain_() NOEXCEPT;
+    bool reclaim_() NOEXCEPT;
+    bool is_pinned_() const NOEXCEPT;
+    epoch& next_epoch_() NOEXCEPT;
 
     // Constants.
     const std::filesystem::path filename_;
     const size_t minimum_;
     const size_t expansion_;
-
-    // Protected by remap_mutex.
-    // requires remap_mutex_ exclusive lock for write.
-    // requires remap_mutex_ minimum shared lock for flush/read.
-    uint8_t* memory_map_{};
-    mutable std::shared_mutex remap_mutex_{};
+    const size_t reservation_;
+    const advice_t advice_;
+    const bool anonymous_;
+
+    // Protected by epoch pinning.
+    // readers pin the published epoch, which is never remapped in place while
+    // pinned. Remap publishes a new epoch and the prior is unmapped once its
+    // readers have drained (in-place remap platforms wait for the drain).
+    std::array<epoch, epochs> epochs_{};
+    std::atomic<epoch*> epoch_{};
+    std::atomic_bool remapping_{};
 
     // Protected by field_mutex.
     // fields require field_mutex_ exclusive lock for write.
@@ -134,10 +184,20 @@ private:
     int opened_{ file::invalid };
     bool fault_{};
     bool loaded_{};
+    bool reserved_{};
+    size_t reserve_{};
     size_t capacity_{};
-    size_t logical_{};
+    uint8_t* memory_map_{};
+    epoch* current_{};
     mutable std::shared_mutex field_mutex_{};
 
+    // Written under field_mutex_ exclusive lock, read without lock.
+    std::atomic<size_t> logical_{};
+
+    // Logical size as of the prior writeback or flush.
+    // Written under field_mutex_ (minimum shared) lock, read without lock.
+    std::atomic<size_t> written_{};
+
     // These are thread safe.
     std::atomic<size_t> space_{ zero };
     std::atomic<error::error_t> error_{ error::success };
@@ -20,10 +20,16 @@
 #define LIBBITCOIN_DATABASE_MEMORY_MEMORY_HPP
 
 #include <bitcoin/database/memory/accessor.hpp>
+#include <bitcoin/database/memory/advice.hpp>
+#include <bitcoin/database/memory/epoch.hpp>
 #include <bitcoin/database/memory/finalizer.hpp>
 #include <bitcoin/database/memory/interfaces/memory.hpp>
 #include <bitcoin/database/memory/interfaces/storage.hpp>
 #include <bitcoin/database/memory/map.hpp>
+#include <bitcoin/database/memory/ram_storage.hpp>
+#include <bitcoin/database/memory/recycler.hpp>
 #include <bitcoin/database/memory/streamers.hpp>
+#include <bitcoin/database/memory/striped_counter.hpp>
+#include <bitcoin/database/memory/utilities.hpp>
 
 #endif
@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_RAM_STORAGE_HPP
+#define LIBBITCOIN_DATABASE_MEMORY_RAM_STORAGE_HPP
+
+#include <atomic>
+#include <filesystem>
+#include <shared_mutex>
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/error.hpp>
+#include <bitcoin/database/file/file.hpp>
+#include <bitcoin/database/memory/accessor.hpp>
+#include <bitcoin/database/memory/advice.hpp>
+#include <bitcoin/database/memory/interfaces/memory.hpp>
+#include <bitcoin/database/memory/interfaces/storage.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Thread safe access to a file held entirely in memory.
+/// The file is read into memory at load and written back at flush and unload,
+/// so access does not incur page cache indirection. Suitable for small files
+/// (such as hashmap heads) that fit in available memory.
+class BCD_API ram_storage
+  : public storage
+{
+public:
+    DELETE_COPY_MOVE(ram_storage);
+
+    /// Parameters match map, reservation, advice and anonymous are unused.
+    ram_storage(const std::filesystem::path& filename, size_t minimum=1,
+        size_t expansion=0, size_t reservation=0,
+        advice_t advice=advice_t::random, bool anonymous=false) NOEXCEPT;
+
+    /// Destruct for debug assertion only.
+    virtual ~ram_storage() NOEXCEPT;
+
+    /// True if the file is open.
+    bool is_open() const NOEXCEPT;
+
+    /// True if the file is loaded into memory.
+    bool is_loaded() const NOEXCEPT;
+
+    /// storage interface
+    /// -----------------------------------------------------------------------
+
+    /// Open file, must be closed.
+    code open() NOEXCEPT override;
+
+    /// Close file, must be unloaded, idempotent.
+    code close() NOEXCEPT override;
+
+    /// Read file into memory, must be unloaded.
+    code load() NOEXCEPT override;
+
+    /// Clear fault condition is not supported, must be loaded, idempotent.
+    code reload() NOEXCEPT override;
+
+    /// Write memory to disk, suspend writes for call, must be loaded.
+    code flush() NOEXCEPT override;
+
+    /// Memory is written only upon flush, no-op, must be loaded.
+    code writeback() NOEXCEPT override;
+
+    /// Write memory to disk, release memory, restartable, idempotent.
+    code unload() NOEXCEPT override;
+
+    /// The filesystem path of the file.
+    const std::filesystem::path& file() const NOEXCEPT override;
+
+    /// The current logical size of the memory (zero if closed).
+    size_t size() const NOEXCEPT override;
+
+    /// The current capacity of the memory (zero if unloaded).
+    size_t capacity() const NOEXCEPT override;
+
+    /// Reduce logical size to specified (false if size exceeds logical).
+    bool truncate(size_t size) NOEXCEPT override;
+
+    /// Allocate bytes and return offset to first allocated (or eof).
+    size_t allocate(size_t chunk) NOEXCEPT override;
+
+    /// Return allocated bytes to storage, false if not at end of logical.
+    bool deallocate(size_t offset, size_t chunk) NOEXCEPT override;
+
+    /// Get r/w access to start/offset of memory (or null).
+    memory_ptr get(size_t offset=zero) const NOEXCEPT override;
+
+    /// Copy size bytes at offset, false if beyond logical (or not loaded).
+    bool copy(uint8_t* to, size_t offset, size_t size) const NOEXCEPT override;
+
+    /// Advice is not applicable, true if loaded and range is valid.
+    bool advise(size_t offset, size_t length,
+        advice_t advice) const NOEXCEPT override;
+
+    /// Get the fault condition.
+    code get_fault() const NOEXCEPT override;
+
+    /// Disk full is not detected, always zero.
+    size_t get_space() const NOEXCEPT override;
+
+protected:
+    size_t to_capacity(size_t required) const NOEXCEPT;
+    void set_first_code(const error::error_t& ec) NOEXCEPT;
+
+private:
+    using path = std::filesystem::path;
+    using access = accessor<std::shared_mutex>;
+
+    bool flush_() NOEXCEPT;
+
+    // Constants.
+    const std::filesystem::path filename_;
+    const size_t minimum_;
+    const size_t expansion_;
+
+    // Protected by field_mutex.
+    // fields require field_mutex_ exclusive lock for write.
+    // fields require minimum field_mutex_ shared lock for flush/read.
+    int opened_{ file::invalid };
+    bool fault_{};
+    mutable std::shared_mutex field_mutex_{};
+
+    // Protected by memory_mutex (and field_mutex for write).
+    // Each accessor holds a memory_mutex_ shared lock, so memory is not
+    // reallocated or released while any accessor exists. memory_mutex_ is
+    // locked before field_mutex_ (as map remap), so accessors may read fields.
+    // Memory is mutable as const get() provides r/w access (as with map).
+    bool loaded_{};
+    mutable system::data_chunk memory_{};
+    mutable std::shared_mutex memory_mutex_{};
+
+    // Written under field_mutex_ exclusive lock, read without lock.
+    std::atomic<size_t> logical_{};
+
+    // These are thread safe.
+    std::atomic<error::error_t> error_{ error::success };
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_RECYCLER_HPP
+#define LIBBITCOIN_DATABASE_MEMORY_RECYCLER_HPP
+
+#include <array>
+#include <new>
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Standard allocator that recycles single-object blocks through a bounded
+/// thread-local free list. Used with std::allocate_shared for short-lived
+/// objects (such as memory accessors), so that warm threads avoid the heap.
+/// Blocks may be released on any thread, cached by the releasing thread.
+template <typename Type>
+class recycler
+{
+public:
+    using value_type = Type;
+
+    inline recycler() NOEXCEPT = default;
+
+    template <typename Other>
+    inline recycler(const recycler<Other>&) NOEXCEPT;
+
+    /// Allocate uninitialized storage for count objects.
+    inline Type* allocate(size_t count) NOEXCEPT;
+
+    /// Release storage obtained from allocate(count).
+    inline void deallocate(Type* block, size_t count) NOEXCEPT;
+
+    /// All instances are interchangeable.
+    template <typename Other>
+    inline bool operator==(const recycler<Other>&) const NOEXCEPT
+    {
+        return true;
+    }
+
+private:
+    static constexpr size_t limit = 64;
+    static_assert(alignof(Type) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+    struct cache
+    {
+        inline ~cache() NOEXCEPT;
+        std::array<void*, limit> blocks{};
+        size_t count{};
+    };
+
+    static inline cache& get_cache() NOEXCEPT;
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#define TEMPLATE template <typename Type>
+#define CLASS recycler<Type>
+
+#include <bitcoin/database/impl/memory/recycler.ipp>
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
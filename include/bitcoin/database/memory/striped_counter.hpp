@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_STRIPED_COUNTER_HPP
+#define LIBBITCOIN_DATABASE_MEMORY_STRIPED_COUNTER_HPP
+
+#include <array>
+#include <atomic>
+#include <shared_mutex>
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Reader count striped across cache lines, so that concurrent readers do not
+/// contend on a shared counter. Drained when no stripe is shared locked.
+class BCD_API striped_counter
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(striped_counter);
+
+    /// Reader count on its own cache line, satisfies shared lockable.
+    class stripe
+    {
+    public:
+        inline void lock_shared() NOEXCEPT
+        {
+            count_.fetch_add(one, std::memory_order_seq_cst);
+        }
+
+        inline void unlock_shared() NOEXCEPT
+        {
+            count_.fetch_sub(one, std::memory_order_release);
+        }
+
+        inline size_t count() const NOEXCEPT
+        {
+            return count_.load(std::memory_order_seq_cst);
+        }
+
+    private:
+        alignas(64) std::atomic<size_t> count_{};
+    };
+
+    /// Shared lock on a stripe (empty if not pinned).
+    using pin = std::shared_lock<stripe>;
+
+    striped_counter() NOEXCEPT;
+
+    /// The stripe of the calling thread, shared lock to pin the counter.
+    stripe& get_stripe() NOEXCEPT;
+
+    /// Pin the stripe of the calling thread.
+    pin get_pin() NOEXCEPT;
+
+    /// True if no reader is pinned.
+    bool is_drained() const NOEXCEPT;
+
+private:
+    static constexpr size_t stripes = 16;
+
+    std::array<stripe, stripes> stripes_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
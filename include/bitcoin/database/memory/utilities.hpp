@@ -21,9 +21,23 @@
 
 #include <bitcoin/database/define.hpp>
 
+#if defined(HAVE_MSC)
+    #include <xmmintrin.h>
+#endif
+
 namespace libbitcoin {
 namespace database {
 
+/// Hint that memory at address will soon be read (never faults).
+inline void prefetch(const void* address) NOEXCEPT
+{
+#if defined(HAVE_MSC)
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    __builtin_prefetch(address);
+#endif
+}
+
 /// The byte size of system pages, zero if failed.
 BCD_API size_t page_size() NOEXCEPT;
 
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_PRIMITIVES_ARENA_HPP
+#define LIBBITCOIN_DATABASE_PRIMITIVES_ARENA_HPP
+
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Bump allocator over a table body, not thread safe (one per thread).
+/// Reserves a contiguous run of the body in one (locked) table allocation and
+/// then allocates from it without locking. The unused remainder is returned
+/// upon release (or destruct) if it remains at the end of the body, otherwise
+/// it is retained as unreferenced padding. For this reason an arena should
+/// only be used with tables that are not enumerated by position (slabs).
+template <typename Table>
+class arena
+{
+public:
+    DELETE_COPY_MOVE(arena);
+
+    using link = typename Table::link;
+
+    /// Reservation is the minimum table allocation (default is exact).
+    arena(Table& table, const link& reservation={}) NOEXCEPT;
+
+    /// Release the unused remainder.
+    ~arena() NOEXCEPT;
+
+    /// The unused remainder of the current reservation.
+    link remaining() const NOEXCEPT;
+
+    /// Allocate and return first logical position (terminal possible).
+    link allocate(const link& size) NOEXCEPT;
+
+    /// Return the unused remainder to the table (false if retained).
+    bool release() NOEXCEPT;
+
+private:
+    using integer = typename link::integer;
+
+    Table& table_;
+    const integer reservation_;
+    integer next_{};
+    integer end_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#define TEMPLATE template <typename Table>
+#define CLASS arena<Table>
+
+#include <bitcoin/database/impl/primitives/arena.ipp>
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
@@ -25,6 +25,7 @@
 #include <bitcoin/database/primitives/head.hpp>
 #include <bitcoin/database/primitives/linkage.hpp>
 #include <bitcoin/database/primitives/manager.hpp>
+#include <bitcoin/database/primitives/view.hpp>
 
 namespace libbitcoin {
 namespace database {
@@ -48,7 +49,7 @@ public:
     bool close() NOEXCEPT;
     bool backup() NOEXCEPT;
     bool restore() NOEXCEPT;
-    bool verify() const NOEXCEPT;
+    bool verify() NOEXCEPT;
 
     /// Sizing.
     /// -----------------------------------------------------------------------
@@ -65,6 +66,10 @@ public:
     /// Count of records (or body file bytes if slab).
     Link count() const NOEXCEPT;
 
+    /// Advise expected access of size records (or slab bytes) from link.
+    bool advise(const Link& link, const Link& size,
+        advice_t advice) const NOEXCEPT;
+
     /// Reduce count as specified.
     bool truncate(const Link& count) NOEXCEPT;
 
@@ -83,10 +88,20 @@ public:
     /// Query interface.
     /// -----------------------------------------------------------------------
 
+    /// Allocate element at returned link (follow with put).
+    Link allocate(const Link& size) NOEXCEPT;
+
+    /// Return allocation, false if not the last allocation of the body.
+    bool deallocate(const Link& link, const Link& size) NOEXCEPT;
+
     /// Get element at link.
     template <typename Element, if_equal<Element::size, Size> = true>
     bool get(const Link& link, Element& element) const NOEXCEPT;
 
+    /// Put element into previously allocated link.
+    template <typename Element, if_equal<Element::size, Size> = true>
+    bool put(const Link& link, const Element& element) NOEXCEPT;
+
     /// Put element.
     template <typename Element, if_equal<Element::size, Size> = true>
     bool put(const Element& element) NOEXCEPT;
@@ -99,7 +114,7 @@ public:
 
 private:
     static constexpr auto is_slab = (Size == max_size_t);
-    using head = database::head<Link, system::data_array<zero>, false>;
+    using head = database::head<Link, system::data_array<zero>, unique_hasher>;
     using manager = database::manager<Link, system::data_array<zero>, Size>;
 
     // Unsafe with zero buckets (index/top/push).
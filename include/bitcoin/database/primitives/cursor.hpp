@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_PRIMITIVES_CURSOR_HPP
+#define LIBBITCOIN_DATABASE_PRIMITIVES_CURSOR_HPP
+
+#include <functional>
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/memory/memory.hpp>
+#include <bitcoin/database/primitives/manager.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// This class is not thread safe.
+/// A lightweight alternative to iterator, the key is referenced (not copied)
+/// and memory is obtained for each hop, so remap is not held off between
+/// hops. Resizing is pinned only for each advance, so it is not held off
+/// between advances. The manager and key must outlive the cursor.
+/// Size non-max implies record manager (ordinal record links).
+template <typename Link, typename Key, size_t Size = max_size_t>
+class cursor
+{
+public:
+    DELETE_COPY_MOVE(cursor);
+
+    using manager = database::manager<Link, Key, Size>;
+    using pinner = std::function<striped_counter::pin()>;
+
+    /// This advances to first match (or terminal).
+    /// The optional pin holds the conflict list against resizing until the
+    /// first match, and the optional pinner pins it for each advance.
+    INLINE cursor(const manager& body, const Link& start, const Key& key,
+        striped_counter::pin&& pin={}, pinner&& repin={}) NOEXCEPT;
+
+    /// Advance to next match and return false if terminal (not found).
+    INLINE bool advance() NOEXCEPT;
+
+    /// The current element (terminal if not found).
+    INLINE const Link& self() const NOEXCEPT;
+
+private:
+    // Read next of self, true if self matches key.
+    INLINE bool read() NOEXCEPT;
+
+    // Hop to next match (or terminal), false if terminal.
+    INLINE bool next() NOEXCEPT;
+
+    // These are thread safe.
+    const manager& body_;
+    const pinner repin_;
+
+    // Referenced (not copied), the referent must outlive the cursor.
+    const Key& key_;
+
+    // These are not thread safe.
+    Link link_;
+    Link next_;
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#define TEMPLATE \
+template <typename Link, typename Key, size_t Size>
+#define CLASS cursor<Link, Key, Size>
+
+#include <bitcoin/database/impl/primitives/cursor.ipp>
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_PRIMITIVES_FILTER_HPP
+#define LIBBITCOIN_DATABASE_PRIMITIVES_FILTER_HPP
+
+#include <atomic>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/primitives/hashers.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Approximate membership filter over hash table keys (in memory).
+/// Blocked bloom filter, all probes of a key are set within one word, so a
+/// test costs one cache miss. A false result is a definite negative, but only
+/// once the filter is ready (all prior keys added), until then it is true.
+template <typename Key>
+class filter
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(filter);
+
+    /// Filter of bytes (rounded down to words), zero disables.
+    filter(size_t bytes) NOEXCEPT;
+
+    /// True if not disabled.
+    bool enabled() const NOEXCEPT;
+
+    /// Remove all keys, ready (not thread safe).
+    void clear() NOEXCEPT;
+
+    /// Remove all keys, not ready until set_ready (not thread safe).
+    void reset() NOEXCEPT;
+
+    /// All prior keys have been added (thread safe).
+    void set_ready() NOEXCEPT;
+    bool is_ready() const NOEXCEPT;
+
+    /// Add key (thread safe), no-op if disabled.
+    void add(const Key& key) NOEXCEPT;
+
+    /// False if key was not added, true if it may have been or if disabled.
+    bool contains(const Key& key) const NOEXCEPT;
+
+private:
+    using word = std::atomic<uint64_t>;
+    static constexpr size_t probes = 5;
+    static constexpr size_t to_words(size_t bytes) NOEXCEPT;
+
+    // Word of key (high hash bits) and mask of its probes (low hash bits).
+    INLINE size_t to_word(uint64_t hash) const NOEXCEPT;
+    static constexpr uint64_t to_mask(uint64_t hash) NOEXCEPT;
+
+    // Thread safe.
+    std::vector<word> words_;
+    std::atomic_bool ready_{ true };
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#define TEMPLATE template <typename Key>
+#define CLASS filter<Key>
+
+#include <bitcoin/database/impl/primitives/filter.ipp>
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
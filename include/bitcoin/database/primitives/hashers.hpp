@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_PRIMITIVES_HASHERS_HPP
+#define LIBBITCOIN_DATABASE_PRIMITIVES_HASHERS_HPP
+
+#include <algorithm>
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Hash function policies for head bucket indexing.
+/// Changing the policy of a table changes its bucket layout (store format).
+
+/// Assumes a high degree of uniqueness in low order 8 bytes of key,
+/// such as keys that are cryptographic hashes.
+struct unique_hasher
+{
+    template <typename Key>
+    static constexpr size_t hash(const Key& key) NOEXCEPT
+    {
+        constexpr auto length = array_count<Key>;
+        constexpr auto size = std::min(length, sizeof(size_t));
+
+        // This optimization breaks data portability (by endianness).
+        // Could be modified to use an endian conversion vs. simple copy.
+        size_t value{};
+        std::copy_n(key.begin(), size, system::byte_cast(value).begin());
+        return value;
+    }
+};
+
+/// djb2 exhibits very poor uniqueness result for sequential keys.
+struct djb2_hasher
+{
+    template <typename Key>
+    static constexpr size_t hash(const Key& key) NOEXCEPT
+    {
+        return system::djb2_hash(key);
+    }
+};
+
+/// Folds all key bytes through the murmur3 64 bit finalizer, so that every
+/// key bit affects every value bit. For non-cryptographic keys, such as
+/// sequential links and composite (link and index) keys.
+struct mix_hasher
+{
+    template <typename Key>
+    static constexpr size_t hash(const Key& key) NOEXCEPT
+    {
+        constexpr auto length = array_count<Key>;
+        constexpr auto word = sizeof(uint64_t);
+
+        uint64_t value{ length };
+        for (size_t start{}; start < length; start += word)
+        {
+            // Little-endian load of next (up to) eight key bytes.
+            uint64_t chunk{};
+            const auto end = std::min(start + word, length);
+            BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+            for (auto byte = end; byte > start; --byte)
+                chunk = (chunk << 8) | key[system::sub1(byte)];
+            BC_POP_WARNING()
+
+            value = mix(value ^ chunk);
+        }
+
+        return system::possible_narrow_cast<size_t>(value);
+    }
+
+private:
+    static constexpr uint64_t mix(uint64_t value) NOEXCEPT
+    {
+        value ^= (value >> 33);
+        value *= 0xff51afd7ed558ccd_u64;
+        value ^= (value >> 33);
+        value *= 0xc4ceb9fe1a85ec53_u64;
+        value ^= (value >> 33);
+        return value;
+    }
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
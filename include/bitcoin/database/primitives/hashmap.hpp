@@ -19,13 +19,19 @@
 #ifndef LIBBITCOIN_DATABASE_PRIMITIVES_HASHMAP_HPP
 #define LIBBITCOIN_DATABASE_PRIMITIVES_HASHMAP_HPP
 
+#include <atomic>
+#include <span>
+#include <thread>
 #include <bitcoin/system.hpp>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/memory/memory.hpp>
+#include <bitcoin/database/primitives/cursor.hpp>
+#include <bitcoin/database/primitives/filter.hpp>
 #include <bitcoin/database/primitives/head.hpp>
 #include <bitcoin/database/primitives/iterator.hpp>
 #include <bitcoin/database/primitives/linkage.hpp>
 #include <bitcoin/database/primitives/manager.hpp>
+#include <bitcoin/database/primitives/view.hpp>
 
 namespace libbitcoin {
 namespace database {
@@ -35,17 +41,31 @@ namespace database {
 /// Readers and writers are always prepositioned at data, and are limited to
 /// the extent the record/slab size is known (limit can always be removed).
 /// Streams are always initialized from first element byte up to file limit.
-template <typename Link, typename Key, size_t Size, bool Hash>
+template <typename Link, typename Key, size_t Size, typename Hash>
 class hashmap
 {
 public:
-    DEFAULT_COPY_MOVE_DESTRUCT(hashmap);
+    DELETE_COPY_MOVE(hashmap);
 
     using key = Key;
     using link = Link;
     using iterator = database::iterator<Link, Key, Size>;
-
-    hashmap(storage& header, storage& body, const Link& buckets) NOEXCEPT;
+    using cursor = database::cursor<Link, Key, Size>;
+
+    /// A nonzero load (records per bucket) enables online resizing of record
+    /// tables, splitting buckets (linear hashing) until it is not exceeded.
+    /// A nonzero filter size (bytes) enables an in memory membership filter,
+    /// which answers definite negative lookups without reading the body. The
+    /// filter is populated in the background upon verify/restore, and answers
+    /// no negatives until populated.
+    /// Fingerprints in head buckets also skip most absent key searches, but
+    /// change the head file format.
+    hashmap(storage& header, storage& body, const Link& buckets,
+        size_t load=zero, size_t filter_size=zero,
+        bool fingerprints=false) NOEXCEPT;
+
+    /// Stops filter population.
+    ~hashmap() NOEXCEPT;
 
     /// Setup, not thread safe.
     /// -----------------------------------------------------------------------
@@ -54,7 +74,11 @@ public:
     bool close() NOEXCEPT;
     bool backup() NOEXCEPT;
     bool restore() NOEXCEPT;
-    bool verify() const NOEXCEPT;
+    bool verify() NOEXCEPT;
+
+    /// Reindex all committed elements into the configured bucket count.
+    /// Requires a verified body count, but not a verified bucket count.
+    bool rebuild() NOEXCEPT;
 
     /// Sizing.
     /// -----------------------------------------------------------------------
@@ -62,18 +86,28 @@ public:
     /// The instance is enabled (more than 1 bucket).
     bool enabled() const NOEXCEPT;
 
-    /// Hash table bucket count.
+    /// The filter is enabled and populated (answers negatives).
+    bool is_filtered() const NOEXCEPT;
+
+    /// Hash table bucket count (grows if resizable).
     size_t buckets() const NOEXCEPT;
 
     /// Head file bytes.
     size_t head_size() const NOEXCEPT;
 
+    /// Bucket count implied by a head file size, zero if invalid.
+    static size_t to_buckets(size_t head_size, bool fingerprints) NOEXCEPT;
+
     /// Body file bytes.
     size_t body_size() const NOEXCEPT;
 
     /// Count of records (or body file bytes if slab).
     Link count() const NOEXCEPT;
 
+    /// Advise expected access of size records (or slab bytes) from link.
+    bool advise(const Link& link, const Link& size,
+        advice_t advice) const NOEXCEPT;
+
     /// Errors.
     /// -----------------------------------------------------------------------
 
@@ -95,15 +129,28 @@ public:
     /// Return first element or terimnal.
     Link first(const Key& key) const NOEXCEPT;
 
-    /// Iterator holds shared lock on storage remap.
+    /// Set first element (or terminal) of each key, false if sizes differ.
+    /// Lookups are staged in groups so that their memory loads overlap.
+    bool first(std::span<const Key> keys,
+        std::span<Link> links) const NOEXCEPT;
+
+    /// Iterator holds shared lock on storage remap (and pins resizing).
     iterator it(const Key& key) const NOEXCEPT;
 
+    /// Cursor references key, holds memory only for each hop and pins
+    /// resizing only for each advance. Use for long conflict list walks, the
+    /// referenced key must outlive the cursor.
+    cursor find(const Key& key) const NOEXCEPT;
+
     /// Return the link at the top of the conflict list (for table scanning).
     Link top(const Link& list) const NOEXCEPT;
 
     /// Allocate element at returned link (follow with set|put).
     Link allocate(const Link& size) NOEXCEPT;
 
+    /// Return allocation, false if not the last allocation of the body.
+    bool deallocate(const Link& link, const Link& size) NOEXCEPT;
+
     /// Return the associated search key (terminal link returns default).
     Key get_key(const Link& link) NOEXCEPT;
 
@@ -139,27 +186,61 @@ public:
     bool commit(const Link& link, const Key& key) NOEXCEPT;
     Link commit_link(const Link& link, const Key& key) NOEXCEPT;
 
+    /// Resizing.
+    /// -----------------------------------------------------------------------
+
+    /// Split the next bucket, false if not resizable or not split.
+    /// Skipped (without blocking lookups) if an iterator or cursor is pinned.
+    bool split() NOEXCEPT;
+
 private:
     static constexpr auto is_slab = (Size == max_size_t);
+    static constexpr size_t group = 16;
+    static constexpr size_t split_backoff = 64;
     using head = database::head<Link, Key, Hash>;
     using manager = database::manager<Link, Key, Size>;
 
+    // Split until load not exceeded (or a split is deferred), following a
+    // commit. A deferred split is retried after split_backoff commits.
+    void rehash() NOEXCEPT;
+
+    // Add the keys of all committed elements to the filter, in the background
+    // (or in place if a thread is not available).
+    bool populate() NOEXCEPT;
+    bool populate_() NOEXCEPT;
+    void stop_populate() NOEXCEPT;
+
+    // Records per bucket, zero if not resizable (slabs are not).
+    const size_t load_;
+
+    // Commits remaining until a deferred split is retried.
+    std::atomic<size_t> backoff_{};
+
     // Thread safe (index/top/push).
     // Not thread safe (create/open/close/backup/restore).
     head head_;
 
     // Thread safe.
     manager manager_;
+
+    // Thread safe (add/contains).
+    // Not thread safe (clear/populate).
+    filter<Key> filter_;
+
+    // Populates filter_ (not thread safe).
+    std::thread populator_{};
+    std::atomic_bool stopping_{};
 };
 
 template <typename Element>
 using hash_map = hashmap<linkage<Element::pk>, system::data_array<Element::sk>,
-    Element::size, Element::hash_function>;
+    Element::size, typename Element::hash_function>;
 
 } // namespace database
 } // namespace libbitcoin
 
-#define TEMPLATE template <typename Link, typename Key, size_t Size, bool Hash>
+#define TEMPLATE template <typename Link, typename Key, size_t Size, \
+    typename Hash>
 #define CLASS hashmap<Link, Key, Size, Hash>
 
 #include <bitcoin/database/impl/primitives/hashmap.ipp>
@@ -20,15 +20,22 @@
 #define LIBBITCOIN_DATABASE_PRIMITIVES_HEAD_HPP
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <mutex>
 #include <shared_mutex>
+#include <vector>
 #include <bitcoin/system.hpp>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/memory/memory.hpp>
+#include <bitcoin/database/primitives/hashers.hpp>
 
 namespace libbitcoin {
 namespace database {
 
-template <typename Link, typename Key, bool Hash>
+/// Hash is a hash function policy (see hashers.hpp).
+template <typename Link, typename Key, typename Hash>
 class head
 {
 public:
@@ -36,8 +43,30 @@ public:
 
     using bytes = typename Link::bytes;
 
+    /// Fingerprint summary follows the link in each bucket (if enabled).
+    using fingerprint = uint16_t;
+
     /// An array head has zero buckets (and cannot call index()).
-    head(storage& head, const Link& buckets) NOEXCEPT;
+    /// A power of two bucket count is indexed by mask, otherwise by modulo.
+    /// A resizable head grows by linear hashing from the given bucket count.
+    /// With fingerprints each bucket also summarizes the key hashes of its
+    /// conflict list, so that most absent keys are not searched in the body.
+    head(storage& head, const Link& buckets, bool resizable=false,
+        bool fingerprints=false) NOEXCEPT;
+
+    /// Bytes per bucket (link, and summary if fingerprinted).
+    static constexpr size_t slot_size(bool fingerprints) NOEXCEPT
+    {
+        return fingerprints ? Link::size + sizeof(fingerprint) : Link::size;
+    }
+
+    /// Bucket count implied by a head file size, zero if invalid.
+    static constexpr size_t to_buckets(size_t size, bool fingerprints) NOEXCEPT
+    {
+        const auto slot = slot_size(fingerprints);
+        return size < Link::size || !is_zero((size - Link::size) % slot) ?
+            zero : (size - Link::size) / slot;
+    }
 
     /// Sizing (thread safe).
     size_t size() const NOEXCEPT;
@@ -47,7 +76,12 @@ public:
     bool create() NOEXCEPT;
 
     /// False if head file size incorrect (not thread safe).
-    bool verify() const NOEXCEPT;
+    /// A resizable head accepts (and adopts) any split bucket count.
+    bool verify() NOEXCEPT;
+
+    /// Recreate at the configured bucket count, returning the prior bucket
+    /// tops. False if head size or body count incorrect (not thread safe).
+    bool rebucket(std::vector<Link>& tops, const Link& count) NOEXCEPT;
 
     /// Unsafe if verify false (not thread safe).
     bool get_body_count(Link& count) const NOEXCEPT;
@@ -57,53 +91,118 @@ public:
     Link index(const Key& key) const NOEXCEPT;
 
     /// Unsafe if verify false.
+    /// Top of key is terminal if excluded by the bucket fingerprints.
+    /// Push to index (without key) sets all bucket fingerprints.
     Link top(const Key& key) const NOEXCEPT;
     Link top(const Link& index) const NOEXCEPT;
     bool push(const bytes& current, bytes& next, const Key& key) NOEXCEPT;
     bool push(const bytes& current, bytes& next, const Link& index) NOEXCEPT;
 
-protected:
-    /// Assumes a high degree of uniqueness in low order 8 bytes of key.
-    static constexpr size_t unique_hash(const Key& key) NOEXCEPT
-    {
-        constexpr auto length = array_count<Key>;
-        constexpr auto size = std::min(length, sizeof(size_t));
-
-        // This optimization breaks data portability (by endianness).
-        // Could be modified to use an endian conversion vs. simple copy.
-        size_t value{};
-        std::copy_n(key.begin(), size, system::byte_cast(value).begin());
-        return value;
-    }
+    /// Hint that the bucket of key will soon be read.
+    void prefetch(const Key& key) const NOEXCEPT;
+
+    /// Resizing (thread safe).
+    /// -----------------------------------------------------------------------
+
+    /// Pin the buckets against splitting, empty if not resizable.
+    /// Blocks while a split is in progress (which does not wait on readers).
+    striped_counter::pin get_pin() const NOEXCEPT;
+
+    /// Begin split of the next bucket (from) into a new bucket (to), and
+    /// return the top of the from conflict list. False if a split is in
+    /// progress, a reader is pinned (new readers are blocked only briefly,
+    /// once drained), or the new bucket cannot be allocated.
+    /// Pushes to the from and to buckets block until end_split.
+    bool begin_split(Link& from, Link& to, Link& top) NOEXCEPT;
+
+    /// Bucket index of key once the current split is ended.
+    Link split_index(const Key& key) const NOEXCEPT;
+
+    /// End split, setting the tops of the from and to conflict lists.
+    void end_split(const Link& from_top, const Link& to_top) NOEXCEPT;
+
+    /// Abandon split, leaving the from conflict list unchanged.
+    void abort_split() NOEXCEPT;
 
 private:
+    // Bucket locks are striped, so pushes to distinct buckets rarely contend.
+    struct alignas(64) stripe
+    {
+        std::shared_mutex mutex{};
+    };
+
+    static constexpr size_t stripes = 64;
+    static constexpr size_t drain_spins = 16;
+
     template <size_t Bytes>
     static auto& array_cast(memory& buffer) NOEXCEPT
     {
         return system::unsafe_array_cast<uint8_t, Bytes>(buffer.begin());
     }
 
-    static constexpr size_t offset(const Link& index) NOEXCEPT
+    constexpr size_t offset(const Link& index) const NOEXCEPT
     {
         using namespace system;
-        BC_ASSERT(!is_multiply_overflow<size_t>(index, Link::size));
-        BC_ASSERT(!is_add_overflow(Link::size, index * Link::size));
+        BC_ASSERT(!is_multiply_overflow<size_t>(index, slot_));
+        BC_ASSERT(!is_add_overflow(Link::size, index * slot_));
 
         // Byte offset of bucket index within head file.
         // [body_size][[bucket[0]...bucket[buckets-1]]]
-        return possible_narrow_cast<size_t>(Link::size + index * Link::size);
+        return possible_narrow_cast<size_t>(Link::size + index * slot_);
+    }
+
+    static constexpr fingerprint to_fingerprint(size_t hash) NOEXCEPT
+    {
+        using namespace system;
+
+        // Two of sixteen bits, selected by the high hash byte, as the bucket
+        // index is taken from the low bits.
+        const auto high = hash >> to_bits(sub1(sizeof(size_t)));
+        return power2<fingerprint>(high & 15u) |
+            power2<fingerprint>((high >> 4) & 15u);
+    }
+
+    static constexpr size_t to_mask(size_t buckets) NOEXCEPT
+    {
+        // Zero (modulo) unless power of two, and bucket count of one is zero.
+        return std::has_single_bit(buckets) ? system::sub1(buckets) : zero;
     }
 
+    Link to_index(size_t hash, size_t count) const NOEXCEPT;
+    bool push(const bytes& current, bytes& next, const Link& index,
+        fingerprint print) NOEXCEPT;
+    static fingerprint get_prints(memory& bucket) NOEXCEPT;
+    static void set_prints(memory& bucket, fingerprint prints) NOEXCEPT;
+    Link top_unlocked(const Link& index) const NOEXCEPT;
+    void set_top_unlocked(const Link& index, const Link& top) NOEXCEPT;
+    std::shared_mutex& get_mutex(const Link& index) const NOEXCEPT;
+    void unlock_split() NOEXCEPT;
+
+    // These are thread safe.
     storage& file_;
     const Link buckets_;
-    mutable std::shared_mutex mutex_{};
+    const size_t mask_;
+    const bool resizable_;
+    const bool fingerprints_;
+    const size_t slot_;
+    std::atomic<size_t> count_;
+    std::atomic_bool splitting_{};
+    mutable std::array<stripe, stripes> stripes_{};
+
+    // Pinned by readers, splitting only while drained.
+    mutable striped_counter readers_{};
+
+    // Protected by split_mutex_ (held by the splitting thread).
+    std::mutex split_mutex_{};
+    Link from_{};
+    Link to_{};
 };
 
 } // namespace database
 } // namespace libbitcoin
 
 
-#define TEMPLATE template <typename Link, typename Key, bool Hash>
+#define TEMPLATE template <typename Link, typename Key, typename Hash>
 #define CLASS head<Link, Key, Hash>
 
 #include <bitcoin/database/impl/primitives/head.ipp>
@@ -35,8 +35,9 @@ public:
     DEFAULT_COPY_MOVE_DESTRUCT(iterator);
 
     /// This advances to first match (or terminal).
+    /// The optional pin holds the conflict list against resizing.
     INLINE iterator(const memory_ptr& data, const Link& start,
-        const Key& key) NOEXCEPT;
+        const Key& key, striped_counter::pin&& pin={}) NOEXCEPT;
 
     /// Advance to and return next iterator.
     INLINE bool advance() NOEXCEPT;
@@ -51,12 +52,15 @@ protected:
 private:
     static constexpr auto is_slab = (Size == max_size_t);
     static constexpr size_t link_to_position(const Link& link) NOEXCEPT;
+    static INLINE bool is_equal(const uint8_t* bytes, const Key& key) NOEXCEPT;
+    INLINE void prefetch(const Link& link) const NOEXCEPT;
 
     // These are thread safe.
     const memory_ptr memory_;
     const Key key_;
 
-    // This is not thread safe.
+    // These are not thread safe.
+    striped_counter::pin pin_;
     Link link_;
 };
 
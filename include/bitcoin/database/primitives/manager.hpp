@@ -53,6 +53,10 @@ public:
     /// For slab size must include bytes (link + data) [key is part of data].
     Link allocate(const Link& size) NOEXCEPT;
 
+    /// Return allocated records, false if not the last allocation.
+    /// For slab, size is bytes, as with allocate.
+    bool deallocate(const Link& link, const Link& size) NOEXCEPT;
+
     /// Return memory object for record at specified position (null possible).
     /// Obtaining memory object is considered const access despite fact that
     /// memory is writeable. Non-const access implies memory map modify.
@@ -61,6 +65,14 @@ public:
     /// Return memory object for the full memory map.
     memory_ptr get() const NOEXCEPT;
 
+    /// Copy size bytes from element at link (false if terminal or beyond).
+    /// Memory is held only for the copy, no memory object is allocated.
+    bool copy(uint8_t* to, const Link& link, size_t size) const NOEXCEPT;
+
+    /// Advise expected access of size records (or slab bytes) from link.
+    bool advise(const Link& link, const Link& size,
+        advice_t advice) const NOEXCEPT;
+
     /// Get the fault condition.
     code get_fault() const NOEXCEPT;
 
@@ -70,9 +82,11 @@ public:
     /// Resume from disk full condition.
     code reload() NOEXCEPT;
 
+    /// Byte offset of the element at link within the memory map.
+    static constexpr size_t link_to_position(const Link& link) NOEXCEPT;
+
 private:
     static constexpr auto is_slab = (Size == max_size_t);
-    static constexpr size_t link_to_position(const Link& link) NOEXCEPT;
     static constexpr Link position_to_link(size_t position) NOEXCEPT;
     static constexpr typename Link::integer cast_link(size_t link) NOEXCEPT;
 
@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_PRIMITIVES_VIEW_HPP
+#define LIBBITCOIN_DATABASE_PRIMITIVES_VIEW_HPP
+
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Zero-copy little-endian field access to the bytes of one fixed size
+/// element (excluding link and key). Field offsets are compile time constants
+/// and the element bound is checked once by its table, so fields are not.
+template <size_t Size>
+class view
+{
+public:
+    static_assert(Size != max_size_t, "views require fixed size elements");
+
+    INLINE view(uint8_t* data) NOEXCEPT;
+
+    /// Read integer of Bytes width at Offset.
+    template <size_t Offset, typename Integer, size_t Bytes = sizeof(Integer)>
+    INLINE Integer get() const NOEXCEPT;
+
+    /// Write integer of Bytes width at Offset.
+    template <size_t Offset, typename Integer, size_t Bytes = sizeof(Integer)>
+    INLINE void set(Integer value) const NOEXCEPT;
+
+    /// Reference to Bytes at Offset.
+    template <size_t Offset, size_t Bytes>
+    INLINE system::data_array<Bytes>& bytes() const NOEXCEPT;
+
+private:
+    uint8_t* data_;
+};
+
+/// An element that reads itself from a view (bypasses reader).
+template <typename Element, size_t Size>
+constexpr bool is_view_readable = requires(Element& element,
+    const view<Size>& source)
+{
+    element.from_view(source);
+};
+
+/// An element that writes itself to a view (bypasses writer).
+template <typename Element, size_t Size>
+constexpr bool is_view_writable = requires(const Element& element,
+    const view<Size>& sink)
+{
+    element.to_view(sink);
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#define TEMPLATE template <size_t Size>
+#define CLASS view<Size>
+
+#include <bitcoin/database/impl/primitives/view.ipp>
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
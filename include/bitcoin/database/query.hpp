@@ -19,6 +19,9 @@
 #ifndef LIBBITCOIN_DATABASE_QUERY_HPP
 #define LIBBITCOIN_DATABASE_QUERY_HPP
 
+#include <deque>
+#include <shared_mutex>
+#include <span>
 #include <utility>
 #include <bitcoin/system.hpp>
 #include <bitcoin/database/association.hpp>
@@ -244,6 +247,8 @@ public:
 
     /// block/tx to block/s (reverse navigation)
     header_link to_parent(const header_link& link) const NOEXCEPT;
+    header_link to_ancestor(const header_link& link,
+        size_t height) const NOEXCEPT;
     header_link to_block(const tx_link& link) const NOEXCEPT;
 
     /// output to spenders (reverse navigation)
@@ -385,6 +390,8 @@ public:
     bool get_version(uint32_t& version, const header_link& link) const NOEXCEPT;
     bool get_bits(uint32_t& bits, const header_link& link) const NOEXCEPT;
     bool get_work(uint256_t& work, const header_link& link) const NOEXCEPT;
+    bool get_cumulative_work(uint256_t& work,
+        const header_link& link) const NOEXCEPT;
     bool get_context(context& ctx, const header_link& link) const NOEXCEPT;
 
     bool set_block_confirmable(const header_link& link, uint64_t fees) NOEXCEPT;
@@ -447,8 +454,22 @@ public:
         const filter& body) NOEXCEPT;
 
 protected:
+    using input_arena = arena<table::input>;
+    using output_arena = arena<table::output>;
+
     code set_code(txs_link& out_fk, const transactions& txs,
         const header_link& key, size_t size) NOEXCEPT;
+    code set_code(tx_link& out_fk, const transaction& tx,
+        input_arena& inputs, output_arena& outputs,
+        std::span<const input_link::integer> ins_sizes,
+        std::span<const output_link::integer> outs_sizes) NOEXCEPT;
+    code set_code(tx_links& out_fks, const transactions& txs, size_t first,
+        size_t last) NOEXCEPT;
+    code set_code_parallel(tx_links& out_fks, const transactions& txs,
+        size_t threads) NOEXCEPT;
+
+    // Txs claimed per archival worker, a block of one batch is serial.
+    static constexpr size_t archive_batch = 64;
 
     /// Translate.
     /// -----------------------------------------------------------------------
@@ -488,11 +509,38 @@ protected:
         index index) const NOEXCEPT;
     inline error::error_t spent_prevout(const foreign_point& point,
         const tx_link& self) const NOEXCEPT;
-    inline error::error_t unspendable_prevout(const point_link& link,
-        uint32_t sequence, uint32_t version, const context& ctx) const NOEXCEPT;
     inline error::error_t unspent_duplicates(const tx_link& link,
         const context& ctx) const NOEXCEPT;
 
+    /// Spend of a block with its prevout resolved for confirmation.
+    struct block_prevout
+    {
+        // spend (under confirmation)
+        foreign_point key{};
+        tx_link parent{};
+        uint32_t sequence{};
+        uint32_t version{};
+
+        // spend->prevout
+        tx_link tx{};
+        header_link block{};
+        uint32_t height{};
+        uint32_t mtp{};
+        bool coinbase{};
+    };
+    using block_prevouts = std_vector<block_prevout>;
+    bool populate_prevouts(block_prevouts& out,
+        const tx_links& txs) const NOEXCEPT;
+    inline error::error_t prevout_confirmable(const block_prevout& prevout,
+        const context& ctx) const NOEXCEPT;
+    code block_confirmable_parallel(const block_prevouts& prevouts,
+        const context& ctx, size_t threads) const NOEXCEPT;
+
+    // Prevouts claimed per confirmation worker, and the count at or below
+    // which confirmation is serial (as thread creation exceeds the work).
+    static constexpr size_t confirm_batch = 8;
+    static constexpr size_t confirm_serial = 64;
+
     /// context
     /// -----------------------------------------------------------------------
 
@@ -508,6 +556,8 @@ protected:
         header_link link) const NOEXCEPT;
     bool populate_hashes(chain_state::data& data,
         const chain_state::map& map) const NOEXCEPT;
+    bool populate_hashes(chain_state::data& data, const chain_state::map& map,
+        const header_link& link) const NOEXCEPT;
     bool populate_work(chain_state::data& data, header_link link) const NOEXCEPT;
     bool populate_all(chain_state::data& data, const system::settings& settings,
         const header_link& link, size_t height) const NOEXCEPT;
@@ -528,14 +578,41 @@ protected:
         const system::settings& settings, const header& header,
         const header_link& link, size_t height) const NOEXCEPT;
 
+    /// candidate window
+
+    struct window_entry
+    {
+        header_link link;
+        uint32_t bits;
+        uint32_t version;
+        uint32_t timestamp;
+    };
+    using window_entries = std_vector<window_entry>;
+    static constexpr size_t window_limit = 4096;
+    bool get_window(window_entries& out, size_t first,
+        size_t count) const NOEXCEPT;
+    void push_window(const header_link& link, size_t height) NOEXCEPT;
+    void pop_window(size_t height) NOEXCEPT;
+    bool is_current(size_t top, const header_link& top_fk) const NOEXCEPT;
+
 private:
     using block_tx = table::strong_tx::record;
     using block_txs = std::vector<block_tx>;
     static inline header_links strong_only(const block_txs& strongs) NOEXCEPT;
     static inline bool contains(const block_txs& blocks,
         const block_tx& block) NOEXCEPT;
+    static inline bool is_distinct(const transactions& txs) NOEXCEPT;
+    static inline void push_sizes(input_links& ins_sizes,
+        output_links& outs_sizes, const transaction& tx) NOEXCEPT;
+    static constexpr size_t to_skip_height(size_t height) NOEXCEPT;
 
     Store& store_;
+
+    // Recent candidate bits/version/timestamp, from height window_start_.
+    // Validated against the candidate top on each use (see get_window).
+    mutable std::shared_mutex window_mutex_{};
+    mutable std::deque<window_entry> window_{};
+    mutable size_t window_start_{};
 };
 
 } // namespace database
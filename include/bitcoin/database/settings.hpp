@@ -22,6 +22,7 @@
 #include <filesystem>
 #include <bitcoin/system.hpp>
 #include <bitcoin/database/define.hpp>
+#include <bitcoin/database/memory/advice.hpp>
 
 namespace libbitcoin {
 namespace database {
@@ -39,50 +40,90 @@ struct BCD_API settings
     /// Properties.
     std::filesystem::path path;
 
+    /// Address space reserved ahead for each body (zero disables).
+    uint64_t reservation;
+
+    /// Threads used to archive the txs of a block (zero or one is serial).
+    uint16_t archive_threads;
+
+    /// Threads used to confirm the spends of a block (zero or one is serial).
+    uint16_t confirm_threads;
+
+    /// Memory access advice for all table heads. Body advice is set per
+    /// table, random for hash tables and normal (not applied) for arrays.
+    advice_t head_advice;
+
+    /// Back all table heads with anonymous (huge page) memory.
+    bool anonymous_heads;
+
+    /// Round all table bucket counts up to a power of two (mask indexing).
+    bool power2_buckets;
+
+    /// Records per bucket at which record hash tables split a bucket (online
+    /// linear hashing), zero disables resizing.
+    uint16_t rehash_load;
+
+    /// Summarize key fingerprints in the head buckets of the point, tx and
+    /// address tables (changes the head format of these tables).
+    bool fingerprint_heads;
+
     /// Archives.
     /// -----------------------------------------------------------------------
 
     uint32_t header_buckets;
     uint64_t header_size;
     uint16_t header_rate;
+    advice_t header_advice;
 
     uint64_t input_size;
     uint16_t input_rate;
+    advice_t input_advice;
 
     uint64_t output_size;
     uint16_t output_rate;
+    advice_t output_advice;
 
     uint32_t point_buckets;
     uint64_t point_size;
     uint16_t point_rate;
+    advice_t point_advice;
+    uint64_t point_filter;
 
     uint64_t puts_size;
     uint16_t puts_rate;
+    advice_t puts_advice;
 
     uint32_t spend_buckets;
     uint64_t spend_size;
     uint16_t spend_rate;
+    advice_t spend_advice;
 
     uint32_t tx_buckets;
     uint64_t tx_size;
     uint16_t tx_rate;
+    advice_t tx_advice;
+    uint64_t tx_filter;
 
     uint32_t txs_buckets;
     uint64_t txs_size;
     uint16_t txs_rate;
+    advice_t txs_advice;
 
     /// Indexes.
     /// -----------------------------------------------------------------------
 
     uint64_t candidate_size;
     uint16_t candidate_rate;
+    advice_t candidate_advice;
 
     uint64_t confirmed_size;
     uint16_t confirmed_rate;
+    advice_t confirmed_advice;
 
     uint32_t strong_tx_buckets;
     uint64_t strong_tx_size;
     uint16_t strong_tx_rate;
+    advice_t strong_tx_advice;
 
     /// Caches.
     /// -----------------------------------------------------------------------
@@ -90,10 +131,12 @@ struct BCD_API settings
     uint32_t validated_bk_buckets;
     uint64_t validated_bk_size;
     uint16_t validated_bk_rate;
+    advice_t validated_bk_advice;
 
     uint32_t validated_tx_buckets;
     uint64_t validated_tx_size;
     uint16_t validated_tx_rate;
+    advice_t validated_tx_advice;
 
     /// Optionals.
     /// -----------------------------------------------------------------------
@@ -101,17 +144,21 @@ struct BCD_API settings
     uint32_t address_buckets;
     uint64_t address_size;
     uint16_t address_rate;
+    advice_t address_advice;
 
     uint32_t neutrino_buckets;
     uint64_t neutrino_size;
     uint16_t neutrino_rate;
+    advice_t neutrino_advice;
 
     ////uint32_t bootstrap_size;
     ////uint16_t bootstrap_rate;
+    ////advice_t bootstrap_advice;
 
     ////uint32_t buffer_buckets;
     ////uint64_t buffer_size;
     ////uint16_t buffer_rate;
+    ////advice_t buffer_advice;
 };
 
 } // namespace database
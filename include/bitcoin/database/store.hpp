@@ -38,7 +38,11 @@ namespace database {
 /// Store provides implmentation support for the public query interface.
 /// Query privides query interface implmentation over the store.
 /// Event handlers are invoked synchronously, providing progress.
-template <typename Storage, if_base_of<storage, Storage> = true>
+/// Head storage may differ from body storage (such as ram_storage for heads).
+/// Head storage applies to the heads of all tables, it is not per table.
+template <typename Storage, typename HeadStorage = Storage,
+    if_base_of<storage, Storage> = true,
+    if_base_of<storage, HeadStorage> = true>
 class store
 {
 public:
@@ -64,12 +68,18 @@ public:
     /// Open and load the set of tables, set locks.
     code open(const event_handler& handler) NOEXCEPT;
 
+    /// Begin writeback of the set of bodies, writes continue (from loaded).
+    code writeback(const event_handler& handler) NOEXCEPT;
+
     /// Snapshot the set of tables (from loaded, leaves loaded).
     code snapshot(const event_handler& handler) NOEXCEPT;
 
     /// Restore the most recent snapshot (from closed, leaves loaded).
     code restore(const event_handler& handler) NOEXCEPT;
 
+    /// Reindex hash tables to configured buckets (from closed, leaves closed).
+    code rebuild(const event_handler& handler) NOEXCEPT;
+
     /// Continue from a disk full condition (from unloaded, leaves loaded).
     code reload(const event_handler& handler) NOEXCEPT;
 
@@ -82,6 +92,12 @@ public:
     /// Get a transactor object.
     const transactor get_transactor() NOEXCEPT;
 
+    /// Get the number of threads used to archive the txs of a block.
+    size_t archive_threads() const NOEXCEPT;
+
+    /// Get the number of threads used to confirm the spends of a block.
+    size_t confirm_threads() const NOEXCEPT;
+
     /// Get first fault code or error::success.
     code get_fault() const NOEXCEPT;
 
@@ -120,6 +136,8 @@ public:
     ////table::buffer buffer;
 
 protected:
+    code write_version() const NOEXCEPT;
+    code check_version() const NOEXCEPT;
     code open_load(const event_handler& handler) NOEXCEPT;
     code unload_close(const event_handler& handler) NOEXCEPT;
     code backup(const event_handler& handler) NOEXCEPT;
@@ -133,80 +151,80 @@ protected:
     /// -----------------------------------------------------------------------
 
     // record hashmap
-    Storage header_head_;
+    HeadStorage header_head_;
     Storage header_body_;
 
     // slab hashmap
-    Storage input_head_;
+    HeadStorage input_head_;
     Storage input_body_;
 
     // blob
-    Storage output_head_;
+    HeadStorage output_head_;
     Storage output_body_;
 
     // record hashmap
-    Storage point_head_;
+    HeadStorage point_head_;
     Storage point_body_;
 
     // array
-    Storage puts_head_;
+    HeadStorage puts_head_;
     Storage puts_body_;
 
     // record hashmap
-    Storage spend_head_;
+    HeadStorage spend_head_;
     Storage spend_body_;
 
     // record hashmap
-    Storage tx_head_;
+    HeadStorage tx_head_;
     Storage tx_body_;
 
     // slab hashmap
-    Storage txs_head_;
+    HeadStorage txs_head_;
     Storage txs_body_;
 
     /// Indexes.
     /// -----------------------------------------------------------------------
 
     // array
-    Storage candidate_head_;
+    HeadStorage candidate_head_;
     Storage candidate_body_;
 
     // array
-    Storage confirmed_head_;
+    HeadStorage confirmed_head_;
     Storage confirmed_body_;
 
     // record hashmap
-    Storage strong_tx_head_;
+    HeadStorage strong_tx_head_;
     Storage strong_tx_body_;
 
     /// Caches.
     /// -----------------------------------------------------------------------
 
     // record hashmap
-    Storage validated_bk_head_;
+    HeadStorage validated_bk_head_;
     Storage validated_bk_body_;
 
     // record multimap
-    Storage validated_tx_head_;
+    HeadStorage validated_tx_head_;
     Storage validated_tx_body_;
 
     /// Optionals.
     /// -----------------------------------------------------------------------
 
     // record hashmap
-    Storage address_head_;
+    HeadStorage address_head_;
     Storage address_body_;
 
     // slab hashmap
-    Storage neutrino_head_;
+    HeadStorage neutrino_head_;
     Storage neutrino_body_;
 
     ////// array
-    ////Storage bootstrap_head_;
+    ////HeadStorage bootstrap_head_;
     ////Storage bootstrap_body_;
 
     ////// slab hashmap
-    ////Storage buffer_head_;
+    ////HeadStorage buffer_head_;
     ////Storage buffer_body_;
 
     /// Locks.
@@ -239,8 +257,9 @@ private:
 } // namespace database
 } // namespace libbitcoin
 
-#define TEMPLATE template <typename Storage, if_base_of<storage, Storage> If>
-#define CLASS store<Storage, If>
+#define TEMPLATE template <typename Storage, typename HeadStorage, \
+    if_base_of<storage, Storage> If, if_base_of<storage, HeadStorage> IfHead>
+#define CLASS store<Storage, HeadStorage, If, IfHead>
 
 #include <bitcoin/database/impl/store.ipp>
 
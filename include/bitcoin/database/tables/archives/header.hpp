@@ -49,6 +49,8 @@ struct header
             bits        = source.read_little_endian<uint32_t>();
             nonce       = source.read_little_endian<uint32_t>();
             merkle_root = source.read_hash();
+            work        = source.read_hash();
+            skip_fk     = source.read_little_endian<link::integer, link::size>();
             BC_ASSERT(source.get_read_position() == minrow);
             return source;
         }
@@ -62,6 +64,8 @@ struct header
             sink.write_little_endian<uint32_t>(bits);
             sink.write_little_endian<uint32_t>(nonce);
             sink.write_bytes(merkle_root);
+            sink.write_bytes(work);
+            sink.write_little_endian<link::integer, link::size>(skip_fk);
             BC_ASSERT(sink.get_write_position() == minrow);
             return sink;
         }
@@ -74,7 +78,9 @@ struct header
                 && timestamp   == other.timestamp
                 && bits        == other.bits
                 && nonce       == other.nonce
-                && merkle_root == other.merkle_root;
+                && merkle_root == other.merkle_root
+                && work        == other.work
+                && skip_fk     == other.skip_fk;
         }
 
         context ctx{};
@@ -84,6 +90,8 @@ struct header
         uint32_t bits{};
         uint32_t nonce{};
         hash_digest merkle_root{};
+        hash_digest work{};
+        link::integer skip_fk{};
     };
 
     struct record_put_ptr
@@ -100,6 +108,8 @@ struct header
             sink.write_little_endian<uint32_t>(header->bits());
             sink.write_little_endian<uint32_t>(header->nonce());
             sink.write_bytes(header->merkle_root());
+            sink.write_bytes(work);
+            sink.write_little_endian<link::integer, link::size>(skip_fk);
             BC_ASSERT(sink.get_write_position() == minrow);
             return sink;
         }
@@ -107,6 +117,8 @@ struct header
         const context ctx{};
         const link::integer parent_fk{};
         system::chain::header::cptr header{};
+        const hash_digest work{};
+        const link::integer skip_fk{ link::terminal };
     };
 
     // This is redundant with record_put_ptr except this does not capture.
@@ -123,6 +135,8 @@ struct header
             sink.write_little_endian<uint32_t>(header.bits());
             sink.write_little_endian<uint32_t>(header.nonce());
             sink.write_bytes(header.merkle_root());
+            sink.write_bytes(work);
+            sink.write_little_endian<link::integer, link::size>(skip_fk);
             BC_ASSERT(sink.get_write_position() == minrow);
             return sink;
         }
@@ -130,6 +144,8 @@ struct header
         const context& ctx{};
         const link::integer parent_fk{};
         const system::chain::header& header;
+        const hash_digest work{};
+        const link::integer skip_fk{ link::terminal };
     };
 
     struct record_with_sk
@@ -166,11 +182,10 @@ struct header
     struct get_version
       : public schema::header
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            source.skip_bytes(context::size + link::size);
-            version = source.read_little_endian<uint32_t>();
-            return source;
+            version = source.get<version_at, uint32_t>();
+            return true;
         }
 
         uint32_t version{};
@@ -179,11 +194,10 @@ struct header
     struct get_timestamp
       : public schema::header
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            source.skip_bytes(context::size + link::size + sizeof(uint32_t));
-            timestamp = source.read_little_endian<uint32_t>();
-            return source;
+            timestamp = source.get<timestamp_at, uint32_t>();
+            return true;
         }
 
         uint32_t timestamp{};
@@ -192,12 +206,10 @@ struct header
     struct get_bits
       : public schema::header
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            source.skip_bytes(context::size + link::size + sizeof(uint32_t) +
-                sizeof(uint32_t));
-            bits = source.read_little_endian<uint32_t>();
-            return source;
+            bits = source.get<bits_at, uint32_t>();
+            return true;
         }
 
         uint32_t bits{};
@@ -206,24 +218,72 @@ struct header
     struct get_parent_fk
       : public schema::header
     {        
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            source.skip_bytes(context::size);
-            parent_fk = source.read_little_endian<link::integer, link::size>();
-            return source;
+            parent_fk = source.get<parent_at, link::integer, link::size>();
+            return true;
         }
 
         link::integer parent_fk{};
     };
 
+    // Cumulative chain work through this header (little-endian uint256).
+    struct get_work
+      : public schema::header
+    {
+        inline bool from_view(const view<size>& source) NOEXCEPT
+        {
+            work = source.bytes<work_at, schema::work>();
+            return true;
+        }
+
+        hash_digest work{};
+    };
+
+    // Skip list ancestry (height, parent and skip links).
+    struct get_ancestry
+      : public schema::header
+    {
+        inline bool from_view(const view<size>& source) NOEXCEPT
+        {
+            using block = context::block;
+            height = source.get<context::flag::size, block::integer,
+                block::size>();
+            parent_fk = source.get<parent_at, link::integer, link::size>();
+            skip_fk = source.get<skip_at, link::integer, link::size>();
+            return true;
+        }
+
+        context::block::integer height{};
+        link::integer parent_fk{};
+        link::integer skip_fk{};
+    };
+
+    // Chain state window values (adjacent fields).
+    struct get_window
+      : public schema::header
+    {
+        inline bool from_view(const view<size>& source) NOEXCEPT
+        {
+            version = source.get<version_at, uint32_t>();
+            timestamp = source.get<timestamp_at, uint32_t>();
+            bits = source.get<bits_at, uint32_t>();
+            return true;
+        }
+
+        uint32_t version{};
+        uint32_t timestamp{};
+        uint32_t bits{};
+    };
+
     struct get_flags
       : public schema::header
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
             using flag = context::flag;
-            flags = source.read_little_endian<flag::integer, flag::size>();
-            return source;
+            flags = source.get<zero, flag::integer, flag::size>();
+            return true;
         }
 
         context::flag::integer flags{};
@@ -232,12 +292,12 @@ struct header
     struct get_height
       : public schema::header
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
             using block = context::block;
-            source.skip_bytes(context::flag::size);
-            height = source.read_little_endian<block::integer, block::size>();
-            return source;
+            height = source.get<context::flag::size, block::integer,
+                block::size>();
+            return true;
         }
 
         context::block::integer height{};
@@ -246,11 +306,11 @@ struct header
     struct get_mtp
       : public schema::header
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            source.skip_bytes(context::flag::size + context::block::size);
-            mtp = source.read_little_endian<uint32_t>();
-            return source;
+            mtp = source.get<context::flag::size + context::block::size,
+                uint32_t>();
+            return true;
         }
 
         uint32_t mtp{};
@@ -277,10 +337,10 @@ struct header
     struct record_context
       : public schema::header
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            context::from_data(source, ctx);
-            return source;
+            context::from_view(source, ctx);
+            return true;
         }
 
         context ctx{};
@@ -103,14 +103,41 @@ struct input
 
         inline bool to_data(flipper& sink) const NOEXCEPT
         {
+            // Relative, as may be written after others (see put_refs).
+            BC_DEBUG_ONLY(const auto start = sink.get_write_position();)
             input.script().to_data(sink, true);
             input.witness().to_data(sink, true);
-            BC_ASSERT(sink.get_write_position() == count());
+            BC_ASSERT(sink.get_write_position() - start == count());
             return sink;
         }
 
         const system::chain::input& input{};
     };
+
+    // Contiguous input slabs of a tx, written with one allocation.
+    struct put_refs
+      : public schema::input
+    {
+        inline link count() const NOEXCEPT
+        {
+            size_t size{};
+            for (const auto& in: inputs)
+                size += put_ref{ {}, *in }.count();
+
+            return system::possible_narrow_cast<link::integer>(size);
+        }
+
+        inline bool to_data(flipper& sink) const NOEXCEPT
+        {
+            for (const auto& in: inputs)
+                put_ref{ {}, *in }.to_data(sink);
+
+            BC_ASSERT(sink.get_write_position() == count());
+            return sink;
+        }
+
+        const system::chain::input_cptrs& inputs{};
+    };
 };
 
 BC_POP_WARNING()
@@ -140,16 +140,44 @@ struct output
 
         inline bool to_data(flipper& sink) const NOEXCEPT
         {
+            // Relative, as may be written after others (see put_refs).
+            BC_DEBUG_ONLY(const auto start = sink.get_write_position();)
             sink.write_little_endian<tx::integer, tx::size>(parent_fk);
             sink.write_variable(output.value());
             output.script().to_data(sink, true);
-            BC_ASSERT(sink.get_write_position() == count());
+            BC_ASSERT(sink.get_write_position() - start == count());
             return sink;
         }
 
         tx::integer parent_fk{};
         const system::chain::output& output{};
     };
+
+    // Contiguous output slabs of a tx, written with one allocation.
+    struct put_refs
+      : public schema::output
+    {
+        inline link count() const NOEXCEPT
+        {
+            size_t size{};
+            for (const auto& out: outputs)
+                size += put_ref{ {}, {}, *out }.count();
+
+            return system::possible_narrow_cast<link::integer>(size);
+        }
+
+        inline bool to_data(flipper& sink) const NOEXCEPT
+        {
+            for (const auto& out: outputs)
+                put_ref{ {}, parent_fk, *out }.to_data(sink);
+
+            BC_ASSERT(sink.get_write_position() == count());
+            return sink;
+        }
+
+        tx::integer parent_fk{};
+        const system::chain::output_cptrs& outputs{};
+    };
 };
 
 BC_POP_WARNING()
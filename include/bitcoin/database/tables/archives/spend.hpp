@@ -124,10 +124,10 @@ struct spend
     struct get_parent
       : public schema::spend
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            parent_fk = source.read_little_endian<tx::integer, tx::size>();
-            return source;
+            parent_fk = source.get<zero, tx::integer, tx::size>();
+            return true;
         }
 
         tx::integer parent_fk{};
@@ -51,6 +51,9 @@ struct transaction
         skip_to_version +
         sizeof(uint32_t);
 
+    static constexpr size_t skip_to_outs = skip_to_puts + ix::size;
+    static constexpr size_t skip_to_fk = skip_to_outs + ix::size;
+
     struct record
       : public schema::transaction
     {
@@ -180,12 +183,11 @@ struct transaction
     struct get_put_counts
       : public schema::transaction
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            source.skip_bytes(skip_to_puts);
-            ins_count  = source.read_little_endian<ix::integer, ix::size>();
-            outs_count = source.read_little_endian<ix::integer, ix::size>();
-            return source;
+            ins_count  = source.get<skip_to_puts, ix::integer, ix::size>();
+            outs_count = source.get<skip_to_outs, ix::integer, ix::size>();
+            return true;
         }
 
         ix::integer ins_count{};
@@ -200,13 +202,12 @@ struct transaction
             return puts_fk + (ins_count * spend::size);
         }
 
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            source.skip_bytes(skip_to_puts);
-            ins_count  = source.read_little_endian<ix::integer, ix::size>();
-            outs_count = source.read_little_endian<ix::integer, ix::size>();
-            puts_fk    = source.read_little_endian<puts::integer, puts::size>();
-            return source;
+            ins_count  = source.get<skip_to_puts, ix::integer, ix::size>();
+            outs_count = source.get<skip_to_outs, ix::integer, ix::size>();
+            puts_fk    = source.get<skip_to_fk, puts::integer, puts::size>();
+            return true;
         }
 
         ix::integer ins_count{};
@@ -222,14 +223,13 @@ struct transaction
             return puts_fk + (ins_count * spend::size);
         }
 
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            source.skip_bytes(skip_to_version);
-            version = source.read_little_endian<uint32_t>();
-            ins_count  = source.read_little_endian<ix::integer, ix::size>();
-            outs_count = source.read_little_endian<ix::integer, ix::size>();
-            puts_fk    = source.read_little_endian<puts::integer, puts::size>();
-            return source;
+            version    = source.get<skip_to_version, uint32_t>();
+            ins_count  = source.get<skip_to_puts, ix::integer, ix::size>();
+            outs_count = source.get<skip_to_outs, ix::integer, ix::size>();
+            puts_fk    = source.get<skip_to_fk, puts::integer, puts::size>();
+            return true;
         }
 
         uint32_t version{};
@@ -241,21 +241,19 @@ struct transaction
     struct get_spend
       : public schema::transaction
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            source.skip_bytes(skip_to_puts);
-            const auto ins_count = source.read_little_endian<ix::integer, ix::size>();
+            const auto ins_count = source.get<skip_to_puts, ix::integer, ix::size>();
 
             if (index >= ins_count)
             {
                 spend_fk = puts::terminal;
-                return source;
+                return true;
             }
 
-            source.skip_bytes(ix::size);
-            const auto puts_fk = source.read_little_endian<puts::integer, puts::size>();
+            const auto puts_fk = source.get<skip_to_fk, puts::integer, puts::size>();
             spend_fk = puts_fk + (index * spend::size);
-            return source;
+            return true;
         }
 
         const puts::integer index{};
@@ -265,21 +263,20 @@ struct transaction
     struct get_output
       : public schema::transaction
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            source.skip_bytes(skip_to_puts);
-            const auto ins_count = source.read_little_endian<ix::integer, ix::size>();
-            const auto outs_count = source.read_little_endian<ix::integer, ix::size>();
+            const auto ins_count = source.get<skip_to_puts, ix::integer, ix::size>();
+            const auto outs_count = source.get<skip_to_outs, ix::integer, ix::size>();
 
             if (index >= outs_count)
             {
                 out_fk = puts::terminal;
-                return source;
+                return true;
             }
 
-            const auto puts_fk = source.read_little_endian<puts::integer, puts::size>();
+            const auto puts_fk = source.get<skip_to_fk, puts::integer, puts::size>();
             out_fk = puts_fk + (ins_count * spend::size) + (index * out::size);
-            return source;
+            return true;
         }
 
         const puts::integer index{};
@@ -289,10 +286,10 @@ struct transaction
     struct get_coinbase
       : public schema::transaction
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            coinbase = to_bool(source.read_byte());
-            return source;
+            coinbase = to_bool(source.get<zero, uint8_t>());
+            return true;
         }
 
         bool coinbase{};
@@ -48,6 +48,15 @@ struct context
         sink.template write_little_endian<uint32_t>(context.mtp);
     };
 
+    template <size_t Size>
+    static inline void from_view(const view<Size>& source,
+        context& context) NOEXCEPT
+    {
+        context.flags  = source.template get<0, flag::integer, flag::size>();
+        context.height = source.template get<flag::size, block::integer, block::size>();
+        context.mtp    = source.template get<flag::size + block::size, uint32_t>();
+    };
+
     constexpr bool is_enabled(system::chain::flags rule) const NOEXCEPT
     {
         return system::chain::script::is_enabled(flags, rule);
@@ -35,13 +35,16 @@ enum class event_t
     close_table,
 
     wait_lock,
+    writeback_body,
     flush_body,
     backup_table,
     copy_header,
     archive_snapshot,
 
     restore_table,
-    recover_snapshot
+    recover_snapshot,
+
+    rebuild_table
 };
 
 } // namespace database
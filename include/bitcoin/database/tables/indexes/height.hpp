@@ -38,16 +38,15 @@ struct height
     struct record
       : public schema::height
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            header_fk = source.read_little_endian<block::integer, block::size>();
-            return source;
+            header_fk = source.get<zero, block::integer, block::size>();
+            return true;
         }
 
-        inline bool to_data(flipper& sink) const NOEXCEPT
+        inline void to_view(const view<size>& sink) const NOEXCEPT
         {
-            sink.write_little_endian<block::integer, block::size>(header_fk);
-            return sink;
+            sink.set<zero, block::integer, block::size>(header_fk);
         }
 
         inline bool operator==(const record& other) const NOEXCEPT
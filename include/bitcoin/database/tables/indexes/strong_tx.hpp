@@ -38,18 +38,17 @@ struct strong_tx
     struct record
       : public schema::strong_tx
     {
-        inline bool from_data(reader& source) NOEXCEPT
+        inline bool from_view(const view<size>& source) NOEXCEPT
         {
-            header_fk = source.read_little_endian<block::integer, block::size>();
-            positive = to_bool(source.read_byte());
-            return source;
+            header_fk = source.get<zero, block::integer, block::size>();
+            positive = to_bool(source.get<block::size, uint8_t>());
+            return true;
         }
 
-        inline bool to_data(finalizer& sink) const NOEXCEPT
+        inline void to_view(const view<size>& sink) const NOEXCEPT
         {
-            sink.write_little_endian<block::integer, block::size>(header_fk);
-            sink.write_byte(to_int<uint8_t>(positive));
-            return sink;
+            sink.set<zero, block::integer, block::size>(header_fk);
+            sink.set<block::size, uint8_t>(to_int<uint8_t>(positive));
         }
 
         inline bool operator==(const record& other) const NOEXCEPT
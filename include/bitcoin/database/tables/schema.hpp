@@ -80,6 +80,11 @@ namespace schema
         constexpr auto process = "process";
     }
 
+    namespace meta
+    {
+        constexpr auto version = "version";
+    }
+
     namespace ext
     {
         constexpr auto head = ".head";
@@ -101,6 +106,11 @@ namespace schema
         disconnected = 2    // final
     };
 
+    /// Store layout version, written at create and required by open. Any
+    /// change to a record or slab layout requires an increment.
+    /// 1: header record adds cumulative work and skip link (62 to 97 bytes).
+    constexpr uint32_t version = 1;
+
     /// Values.
     constexpr size_t bit = 1;       // single bit flag.
     constexpr size_t code = 1;      // validation state.
@@ -109,6 +119,7 @@ namespace schema
     constexpr size_t index = 3;     // input/output index.
     constexpr size_t sigops = 3;    // signature op count.
     constexpr size_t flags = 4;     // fork flags.
+    constexpr size_t work = 32;     // cumulative chain work.
 
     /// Primary keys.
     constexpr size_t put = 5;       // ->input/output slab.
@@ -132,7 +143,7 @@ namespace schema
     // record hashmap
     struct header
     {
-        static constexpr bool hash_function = false;
+        using hash_function = unique_hasher;
         static constexpr size_t pk = schema::block;
         static constexpr size_t sk = schema::hash;
         static constexpr size_t minsize =
@@ -144,12 +155,25 @@ namespace schema
             sizeof(uint32_t) +
             sizeof(uint32_t) +
             sizeof(uint32_t) +
-            schema::hash;
+            schema::hash +
+            schema::work +
+            pk;
         static constexpr size_t minrow = pk + sk + minsize;
         static constexpr size_t size = minsize;
         static constexpr linkage<pk> count() NOEXCEPT { return 1; }
-        static_assert(minsize == 62u);
-        static_assert(minrow == 97u);
+        static_assert(minsize == 97u);
+        static_assert(minrow == 132u);
+
+        // Field offsets (context is flags, height and mtp).
+        static constexpr size_t parent_at = schema::flags + schema::block +
+            sizeof(uint32_t);
+        static constexpr size_t version_at = parent_at + pk;
+        static constexpr size_t timestamp_at = version_at + sizeof(uint32_t);
+        static constexpr size_t bits_at = timestamp_at + sizeof(uint32_t);
+        static constexpr size_t work_at = bits_at + 2u * sizeof(uint32_t) +
+            schema::hash;
+        static constexpr size_t skip_at = work_at + schema::work;
+        static_assert(skip_at + pk == minsize);
     };
 
     // blob
@@ -169,7 +193,7 @@ namespace schema
     // record hashmap
     struct transaction
     {
-        static constexpr bool hash_function = false;
+        using hash_function = unique_hasher;
         static constexpr size_t pk = schema::tx;
         static constexpr size_t sk = schema::hash;
         static constexpr size_t minsize =
@@ -220,7 +244,7 @@ namespace schema
     // moderate (sk:7) record multimap, with low multiple rate.
     struct spend
     {
-        static constexpr bool hash_function = false;
+        using hash_function = mix_hasher;
         static constexpr size_t pk = schema::spend_;
         static constexpr size_t sk = transaction::pk + schema::index;
         static constexpr size_t minsize =
@@ -237,7 +261,7 @@ namespace schema
     // record hashmap
     struct point
     {
-        static constexpr bool hash_function = false;
+        using hash_function = unique_hasher;
         static constexpr size_t pk = schema::point_;
         static constexpr size_t sk = schema::hash;
         static constexpr size_t minsize = zero;
@@ -251,7 +275,7 @@ namespace schema
     // slab hashmap
     struct txs
     {
-        static constexpr bool hash_function = false;
+        using hash_function = mix_hasher;
         static constexpr size_t pk = schema::txs_;
         static constexpr size_t sk = schema::header::pk;
         static constexpr size_t minsize =
@@ -285,7 +309,7 @@ namespace schema
     // large (sk:32) record multimap, with high multiple rate.
     struct address
     {
-        static constexpr bool hash_function = false;
+        using hash_function = unique_hasher;
         static constexpr size_t pk = schema::puts_;
         ////static constexpr size_t sk = schema::point::pk;
         static constexpr size_t sk = schema::hash;
@@ -301,7 +325,7 @@ namespace schema
     // record hashmap
     struct strong_tx
     {
-        static constexpr bool hash_function = false;
+        using hash_function = mix_hasher;
         static constexpr size_t pk = schema::tx;
         static constexpr size_t sk = schema::transaction::pk;
         static constexpr size_t minsize =
@@ -319,7 +343,7 @@ namespace schema
     // slab hashmap
     struct validated_bk
     {
-        static constexpr bool hash_function = false;
+        using hash_function = mix_hasher;
         static constexpr size_t pk = schema::bk_slab;
         static constexpr size_t sk = schema::header::pk;
         static constexpr size_t minsize =
@@ -334,7 +358,7 @@ namespace schema
     // modest (sk:4) slab multimap, with low multiple rate.
     struct validated_tx
     {
-        static constexpr bool hash_function = false;
+        using hash_function = mix_hasher;
         static constexpr size_t pk = schema::tx_slab;
         static constexpr size_t sk = schema::transaction::pk;
         static constexpr size_t minsize =
@@ -353,7 +377,7 @@ namespace schema
     // slab hashmap
     struct neutrino
     {
-        static constexpr bool hash_function = false;
+        using hash_function = mix_hasher;
         static constexpr size_t pk = schema::neutrino_;
         static constexpr size_t sk = schema::header::pk;
         static constexpr size_t minsize =
@@ -381,7 +405,7 @@ namespace schema
     ////// slab hashmap
     ////struct buffer
     ////{
-    ////    static constexpr bool hash_function = false;
+    ////    using hash_function = mix_hasher;
     ////    static constexpr size_t pk = schema::buffer_;
     ////    static constexpr size_t sk = schema::transaction::pk;
     ////    static constexpr size_t minsize = zero;
@@ -76,6 +76,8 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { backup_table, "failed to backup table" },
     { restore_table, "failed to restore table" },
     { verify_table, "failed to verify table" },
+    { rebuild_table, "failed to rebuild table" },
+    { store_version, "incompatible store version" },
 
     // states
     { tx_connected, "transaction connected" },
@@ -20,10 +20,14 @@
 
 #if defined(HAVE_MSC)
     #include <io.h>
+#else
+    #include <unistd.h>
 #endif
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <algorithm>
+#include <cerrno>
 #include <filesystem>
 #include <ios>
 #include <iostream>
@@ -329,6 +333,75 @@ code size_ex(size_t& out, int file_descriptor) NOEXCEPT
     return system::error::get_errno();
 }
 
+// End of file before size is a read failure. Interrupted calls are resumed.
+bool read(int file_descriptor, uint8_t* data, size_t size) NOEXCEPT
+{
+#if defined(HAVE_MSC)
+    if (::_lseeki64(file_descriptor, 0, SEEK_SET) == -1)
+        return false;
+#endif
+
+    for (size_t offset{}; offset < size;)
+    {
+        const auto remaining = size - offset;
+
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+#if defined(HAVE_MSC)
+        const auto bytes = ::_read(file_descriptor, data + offset,
+            possible_narrow_cast<unsigned>(std::min(remaining,
+                size_t{ max_int32 })));
+#else
+        const auto bytes = ::pread(file_descriptor, data + offset, remaining,
+            possible_narrow_sign_cast<off_t>(offset));
+#endif
+        BC_POP_WARNING()
+
+        if (bytes == -1 && errno == EINTR)
+            continue;
+
+        if (bytes <= 0)
+            return false;
+
+        offset += sign_cast<size_t>(bytes);
+    }
+
+    return true;
+}
+
+bool write(int file_descriptor, const uint8_t* data, size_t size) NOEXCEPT
+{
+#if defined(HAVE_MSC)
+    if (::_lseeki64(file_descriptor, 0, SEEK_SET) == -1)
+        return false;
+#endif
+
+    for (size_t offset{}; offset < size;)
+    {
+        const auto remaining = size - offset;
+
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+#if defined(HAVE_MSC)
+        const auto bytes = ::_write(file_descriptor, data + offset,
+            possible_narrow_cast<unsigned>(std::min(remaining,
+                size_t{ max_int32 })));
+#else
+        const auto bytes = ::pwrite(file_descriptor, data + offset, remaining,
+            possible_narrow_sign_cast<off_t>(offset));
+#endif
+        BC_POP_WARNING()
+
+        if (bytes == -1 && errno == EINTR)
+            continue;
+
+        if (bytes <= 0)
+            return false;
+
+        offset += sign_cast<size_t>(bytes);
+    }
+
+    return true;
+}
+
 bool size(size_t& out, const std::filesystem::path& filename) NOEXCEPT
 {
     return !size_ex(out, filename);
@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/memory/epoch.hpp>
+
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+using namespace system;
+
+epoch::epoch() NOEXCEPT
+{
+}
+
+void epoch::assign(uint8_t* memory, size_t capacity) NOEXCEPT
+{
+    memory_ = memory;
+    capacity_ = capacity;
+}
+
+uint8_t* epoch::memory() const NOEXCEPT
+{
+    return memory_;
+}
+
+size_t epoch::capacity() const NOEXCEPT
+{
+    return capacity_;
+}
+
+BC_POP_WARNING()
+
+} // namespace database
+} // namespace libbitcoin
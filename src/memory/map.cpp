@@ -27,14 +27,18 @@
 #endif
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <fcntl.h>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
+#include <thread>
 #include <bitcoin/system.hpp>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/error.hpp>
 #include <bitcoin/database/file/file.hpp>
+#include <bitcoin/database/memory/recycler.hpp>
+#include <bitcoin/database/memory/utilities.hpp>
 
 namespace libbitcoin {
 namespace database {
@@ -43,8 +47,14 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
 using namespace system;
 
-map::map(const path& filename, size_t minimum, size_t expansion) NOEXCEPT
-  : filename_(filename), minimum_(minimum), expansion_(expansion)
+map::map(const path& filename, size_t minimum, size_t expansion,
+    size_t reservation, advice_t advice, bool anonymous) NOEXCEPT
+  : filename_(filename),
+    minimum_(minimum),
+    expansion_(expansion),
+    reservation_(reservation),
+    advice_(advice),
+    anonymous_(anonymous)
 {
 }
 
@@ -52,7 +62,8 @@ map::~map() NOEXCEPT
 {
     BC_ASSERT_MSG(!loaded_, "file mapped at destruct");
     BC_ASSERT_MSG(is_null(memory_map_), "map defined at destruct");
-    BC_ASSERT_MSG(is_zero(logical_), "logical nonzero at destruct");
+    BC_ASSERT_MSG(is_null(epoch_.load()), "epoch published at destruct");
+    BC_ASSERT_MSG(is_zero(logical_.load()), "logical nonzero at destruct");
     BC_ASSERT_MSG(is_zero(capacity_), "capacity nonzero at destruct");
     BC_ASSERT_MSG(opened_ == file::invalid, "file open at destruct");
 }
@@ -72,12 +83,14 @@ code map::open() NOEXCEPT
     if (const auto ec = file::open_ex(opened_, filename_))
         return ec;
 
-    return file::size_ex(logical_, opened_);
+    size_t logical{};
+    const auto ec = file::size_ex(logical, opened_);
+    logical_.store(logical);
+    return ec;
 }
 
 code map::close() NOEXCEPT
 {
-    std::unique_lock map_lock(remap_mutex_);
     std::unique_lock field_lock(field_mutex_);
 
     if (loaded_)
@@ -88,7 +101,7 @@ code map::close() NOEXCEPT
 
     const auto descriptor = opened_;
     opened_ = file::invalid;
-    logical_ = zero;
+    logical_.store(zero);
 
     return file::close_ex(descriptor);
 }
@@ -101,9 +114,11 @@ bool map::is_open() const NOEXCEPT
 
 // map, flush, unmap.
 // ----------------------------------------------------------------------------
-// Each accessor holds a shared lock on remap_mutex_ (read/write access to map).
-// Exclusive lock on remap_mutex_ ensures there are open accessor objects,
-// which allows for safely remapping the memory map.
+// Each accessor pins the epoch (mapping generation) that was published when it
+// was obtained. Pinning touches only a per-thread stripe of the epoch, so
+// readers neither contend with each other nor wait on a remap. A remap
+// publishes a new epoch and the prior mapping is unmapped once drained.
+// Load/reload/unload are precluded while any epoch remains pinned.
 
 // TODO: map_, flush_, unmap_, remap_ (resize_, finalize_) return codes.
 
@@ -111,26 +126,17 @@ code map::load() NOEXCEPT
 {
     std::unique_lock field_lock(field_mutex_);
 
-    if (remap_mutex_.try_lock())
-    {
-        if (loaded_)
-        {
-            remap_mutex_.unlock();
-            return error::load_loaded;
-        }
+    if (is_pinned_())
+        return error::load_locked;
 
-        // Updates fields.
-        if (!map_())
-        {
-            remap_mutex_.unlock();
-            return error::load_failure;
-        }
+    if (loaded_)
+        return error::load_loaded;
 
-        remap_mutex_.unlock();
-        return error::success;
-    }
+    // Updates fields.
+    if (!map_())
+        return error::load_failure;
 
-    return error::load_locked;
+    return error::success;
 }
 
 // Suspend writes before calling.
@@ -138,29 +144,21 @@ code map::reload() NOEXCEPT
 {
     std::unique_lock field_lock(field_mutex_);
 
-    if (remap_mutex_.try_lock())
-    {
-        if (!loaded_)
-        {
-            remap_mutex_.unlock();
-            return error::reload_unloaded;
-        }
-
-        // Allow resume from disk full.
-        set_disk_space(zero);
+    if (is_pinned_())
+        return error::reload_locked;
 
-        remap_mutex_.unlock();
-        return error::success;
-    }
+    if (!loaded_)
+        return error::reload_unloaded;
 
-    return error::reload_locked;
+    // Allow resume from disk full.
+    set_disk_space(zero);
+    return error::success;
 }
 
 // Suspend writes before calling.
 code map::flush() NOEXCEPT
 {
     // Prevent unload, resize, remap.
-    std::shared_lock map_lock(remap_mutex_);
     std::shared_lock field_lock(field_mutex_);
 
     if (!loaded_)
@@ -170,33 +168,37 @@ code map::flush() NOEXCEPT
     return flush_() ? error::success : error::flush_failure;
 }
 
+// Writes need not be suspended.
+code map::writeback() NOEXCEPT
+{
+    // Prevent unload, resize, remap.
+    std::shared_lock field_lock(field_mutex_);
+
+    if (!loaded_)
+        return error::flush_unloaded;
+
+    // Reads fields and the memory map.
+    return writeback_() ? error::success : error::flush_failure;
+}
+
 // Suspend writes before calling.
 code map::unload() NOEXCEPT
 {
     std::unique_lock field_lock(field_mutex_);
 
-    if (remap_mutex_.try_lock())
-    {
-        if (!loaded_)
-        {
-            remap_mutex_.unlock();
-            return error::success;
-        }
+    if (is_pinned_())
+        return error::unload_locked;
 
-        BC_ASSERT_MSG(logical_ <= capacity_, "logical size exceeds capacity");
+    if (!loaded_)
+        return reclaim_() ? error::success : error::unload_failure;
 
-        // Updates fields.
-        if (!unmap_())
-        {
-            remap_mutex_.unlock();
-            return error::unload_failure;
-        }
+    BC_ASSERT_MSG(logical_.load() <= capacity_, "logical exceeds capacity");
 
-        remap_mutex_.unlock();
-        return error::success;
-    }
+    // Updates fields.
+    if (!unmap_())
+        return error::unload_failure;
 
-    return error::unload_locked;
+    return error::success;
 }
 
 bool map::is_loaded() const NOEXCEPT
@@ -210,8 +212,7 @@ bool map::is_loaded() const NOEXCEPT
 
 size_t map::size() const NOEXCEPT
 {
-    std::shared_lock field_lock(field_mutex_);
-    return logical_;
+    return logical_.load();
 }
 
 size_t map::capacity() const NOEXCEPT
@@ -224,62 +225,138 @@ bool map::truncate(size_t size) NOEXCEPT
 {
     std::unique_lock field_lock(field_mutex_);
 
-    if (size > logical_)
+    if (size > logical_.load())
         return false;
 
-    logical_ = size;
+    logical_.store(size);
     return true;
 }
 
-// Waits until all access pointers are destructed. Will deadlock if any access
-// pointer is waiting on allocation. Lock safety requires that access pointers
-// are short-lived and do not block on allocation.
+// Remap does not wait on access pointers where the platform supports mapping
+// anew (the prior mapping is retired). Where remap is in place it waits until
+// all access pointers are destructed, and will deadlock if any access pointer
+// is waiting on allocation. Lock safety requires that access pointers are
+// short-lived and do not block on allocation.
 size_t map::allocate(size_t chunk) NOEXCEPT
 {
     std::unique_lock field_lock(field_mutex_);
 
-    if (fault_ || !loaded_ || is_add_overflow(logical_, chunk))
+    const auto logical = logical_.load();
+    if (fault_ || !loaded_ || is_add_overflow(logical, chunk))
         return storage::eof;
 
-    auto end = logical_ + chunk;
+    const auto end = logical + chunk;
     if (end > capacity_)
     {
-        const auto size = to_capacity(end);
-
-        // TODO: Could loop over a try lock here and log deadlock warning.
-        std::unique_lock remap_lock(remap_mutex_);
-
         // Disk full condition leaves store in valid state despite eof return.
-        if (!remap_(size))
+        if (!remap_(to_capacity(end)))
             return storage::eof;
     }
 
-    std::swap(logical_, end);
-    return end;
+    // Logical is stored after the epoch of required capacity is published.
+    logical_.store(end);
+    return logical;
+}
+
+bool map::deallocate(size_t offset, size_t chunk) NOEXCEPT
+{
+    std::unique_lock field_lock(field_mutex_);
+
+    // Only the last allocation can be returned, capacity is retained.
+    if (is_add_overflow(offset, chunk) || offset + chunk != logical_.load())
+        return false;
+
+    logical_.store(offset);
+    return true;
 }
 
 memory_ptr map::get(size_t offset) const NOEXCEPT
 {
-    // Obtaining logical before access prevents mutual mutex wait (deadlock).
-    // The store could remap between here and next line, but logical size
-    // only increases. Close zeroizes logical but must be unloaded to do so.
-    // Truncate can reduce logical, but capacity is not affected. It is always
-    // the case that ptr may write past current logical, so long as it never
-    // writes past current capacity. Truncation is managed by callers.
+    // Obtaining logical before pinning ensures the pinned epoch has capacity
+    // for it, as logical is stored after its epoch is published. Logical size
+    // only increases while loaded. Truncate can reduce logical, but capacity
+    // is not affected. It is always the case that ptr may write past current
+    // logical, so long as it never writes past current capacity. Truncation
+    // is managed by callers.
     const auto logical = size();
 
-    // Takes a shared lock on remap_mutex_ until destruct, blocking remap.
-    const auto ptr = std::make_shared<access>(remap_mutex_);
+    while (true)
+    {
+        const auto current = epoch_.load();
+
+        if (is_null(current))
+        {
+            // Unloaded, or an in-place remap is underway (wait).
+            if (!remapping_.load())
+                return nullptr;
 
-    // loaded_ update is precluded by remap_mutex_, making this read atomic.
-    if (!loaded_ || is_null(ptr))
-        return nullptr;
+            std::this_thread::yield();
+            continue;
+        }
 
-    // With offset > size the assignment is negative (stream is exhausted).
-    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
-    ptr->assign(memory_map_ + offset, memory_map_ + logical);
-    BC_POP_WARNING()
-    return ptr;
+        // Pins the epoch until destruct, the control block is recycled.
+        const auto ptr = std::allocate_shared<access>(recycler<access>{},
+            current->get_stripe());
+
+        // The pin holds only if the epoch remains published, otherwise retry.
+        if (epoch_.load() != current)
+            continue;
+
+        // With offset > size the assignment is negative (stream is exhausted).
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+        const auto memory = current->memory();
+        ptr->assign(memory + offset, memory + logical);
+        BC_POP_WARNING()
+        return ptr;
+    }
+}
+
+bool map::copy(uint8_t* to, size_t offset, size_t size) const NOEXCEPT
+{
+    // Logical is obtained before pinning, as with get.
+    const auto logical = this->size();
+    if (is_add_overflow(offset, size) || offset + size > logical)
+        return false;
+
+    while (true)
+    {
+        const auto current = epoch_.load();
+
+        if (is_null(current))
+        {
+            // Unloaded, or an in-place remap is underway (wait).
+            if (!remapping_.load())
+                return false;
+
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Pins the epoch for the copy only.
+        const epoch::pin pin{ current->get_stripe() };
+
+        // The pin holds only if the epoch remains published, otherwise retry.
+        if (epoch_.load() != current)
+            continue;
+
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+        std::memcpy(to, current->memory() + offset, size);
+        BC_POP_WARNING()
+        return true;
+    }
+}
+
+bool map::advise(size_t offset, size_t length,
+    advice_t advice) const NOEXCEPT
+{
+    // Shared lock precludes remap/unload during advice.
+    std::shared_lock field_lock(field_mutex_);
+
+    if (!loaded_ || is_add_overflow(offset, length) ||
+        offset + length > capacity_)
+        return false;
+
+    return advise_(offset, length, advice);
 }
 
 code map::get_fault() const NOEXCEPT
@@ -306,7 +383,7 @@ size_t map::to_capacity(size_t required) const NOEXCEPT
     return target;
 }
 
-// Read-write protected by atomic, write-write protected by remap_mutex.
+// Read-write protected by atomic, write-write protected by field_mutex.
 void map::set_first_code(const error::error_t& ec) NOEXCEPT
 {
     if (!fault_)
@@ -332,13 +409,26 @@ constexpr auto fail = -1;
 // Never results in unmapped.
 bool map::flush_() NOEXCEPT
 {
+    // All logical memory is synchronized (or faulted) by the flush.
+    written_.store(logical_.load());
+
+#if !defined(HAVE_MSC)
+    // Anonymous memory is not file backed, so write it back before sync.
+    if (anonymous_ && !write_())
+    {
+        set_first_code(error::flush_failure);
+        return false;
+    }
+#endif
+
     // msync should not be required on modern linux, see linus et al.
     // stackoverflow.com/questions/5902629/mmap-msync-and-linux-process-termination
 #if defined(HAVE_MSC)
     // unmap (and therefore msync) must be called before ftruncate.
     // "To flush all the dirty pages plus the metadata for the file and ensure
     // that they are physically written to disk..."
-    const auto success = (::msync(memory_map_, logical_, MS_SYNC) != fail) 
+    const auto success =
+           (::msync(memory_map_, logical_.load(), MS_SYNC) != fail)
         && (::fsync(opened_) != fail);
 #elif defined(F_FULLFSYNC)
     // macOS msync fails with zero logical size (but we are no longer calling).
@@ -360,29 +450,82 @@ bool map::flush_() NOEXCEPT
     return success;
 }
 
+// Never results in unmapped.
+// Writeback is advisory, so failure does not set a fault code.
+// Bodies are append-mostly, so only pages from the prior writeback are
+// written. Pages modified in place below it are synchronized by flush.
+bool map::writeback_() NOEXCEPT
+{
+#if !defined(HAVE_MSC)
+    // Anonymous memory is not file backed, so is written back by flush.
+    if (anonymous_)
+        return true;
+#endif
+
+    const auto logical = logical_.load();
+    const auto written = std::min(written_.exchange(logical), logical);
+
+    // Writeback address must be page aligned (map is page aligned).
+    const auto page = page_size();
+    const auto start = is_zero(page) ? written : (written / page) * page;
+    if (start >= logical)
+        return true;
+
+#if !defined(HAVE_MSC) && defined(SYNC_FILE_RANGE_WRITE)
+    // Linux: initiates writeout of dirty pages in range, does not wait.
+    return ::sync_file_range(opened_, possible_narrow_sign_cast<off_t>(start),
+        possible_narrow_sign_cast<off_t>(logical - start),
+        SYNC_FILE_RANGE_WRITE) != fail;
+#else
+    // Schedules writeout of dirty pages in range, does not wait.
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    return ::msync(memory_map_ + start, logical - start, MS_ASYNC) != fail;
+    BC_POP_WARNING()
+#endif
+}
+
 // Always results in unmapped.
 // Trims to logical size, can be zero.
+// A mapping that remains pinned (only on failure paths) is unmapped on drain.
 bool map::unmap_() NOEXCEPT
 {
+    const auto logical = logical_.load();
+
+#if !defined(HAVE_MSC)
+    // Anonymous memory is not file backed, so write it back before unmap.
+    // Memory is retained (and published) upon failure, so that unload may be
+    // retried, as it is the only copy.
+    if (anonymous_ && !write_())
+    {
+        set_first_code(error::unload_failure);
+        return false;
+    }
+#endif
+
+    // Unpublish, any epoch not yet drained is retired.
+    epoch_.store(nullptr);
+    current_ = nullptr;
+
 #if defined(HAVE_MSC)
     const auto success =
-           (::msync(memory_map_, logical_, MS_SYNC) != fail)
-        && (::munmap(memory_map_, capacity_) != fail)
-        && (::ftruncate(opened_, logical_) != fail)
+           (::msync(memory_map_, logical, MS_SYNC) != fail)
+        && reclaim_()
+        && (::ftruncate(opened_, logical) != fail)
         && (::fsync(opened_) != fail);
 #else
-    const auto success = (::ftruncate(opened_, logical_) != fail)
+    const auto success = (::ftruncate(opened_, logical) != fail)
     #if defined(F_FULLFSYNC)
         && (::fcntl(opened_, F_FULLFSYNC, 0) != fail)
     #else
         && (::fsync(opened_) != fail)
     #endif
-        && (::munmap(memory_map_, capacity_) != fail);
+        && reclaim_();
 #endif
     if (!success)
         set_first_code(error::munmap_failure);
 
     loaded_ = false;
+    reserved_ = false;
     capacity_ = zero;
     memory_map_ = {};
     return success;
@@ -392,13 +535,58 @@ bool map::unmap_() NOEXCEPT
 // Mapping has no effect on logical size, always maps max(logical, min) size.
 bool map::map_() NOEXCEPT
 {
-    auto size = logical_;
+    auto size = logical_.load();
+    written_.store(size);
 
     // Cannot map empty file, and want mininum capacity, so expand as required.
     // disk_full: space is set but no code is set with false return.
     if ((size < minimum_) && !resize_((size = minimum_)))
       return false;
 
+#if !defined(HAVE_MSC)
+    // Anonymous memory is populated from the file, which is not mapped.
+    if (anonymous_)
+    {
+        memory_map_ = allocate_(size);
+
+        // Discard memory upon read failure, so that it is not written back.
+        if (memory_map_ != MAP_FAILED && !read_())
+        {
+            ::munmap(memory_map_, reserved_ ? reserve_ : size);
+            memory_map_ = pointer_cast<uint8_t>(MAP_FAILED);
+        }
+
+        return finalize_(size);
+    }
+
+    // Reserve inaccessible address space and map the file at its base. Not
+    // writable, so the reservation does not commit memory.
+    if (reservation_ > size)
+    {
+        const auto base = ::mmap(nullptr, reservation_, PROT_NONE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        // Reservation failure falls back to an unreserved mapping.
+        if (base != MAP_FAILED)
+        {
+            memory_map_ = pointer_cast<uint8_t>(::mmap(base, size,
+                PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, opened_, 0));
+
+            if (memory_map_ == MAP_FAILED)
+            {
+                ::munmap(base, reservation_);
+            }
+            else
+            {
+                reserved_ = true;
+                reserve_ = reservation_;
+            }
+
+            return finalize_(size);
+        }
+    }
+#endif
+
     memory_map_ = pointer_cast<uint8_t>(::mmap(nullptr, size,
         PROT_READ | PROT_WRITE, MAP_SHARED, opened_, 0));
 
@@ -409,45 +597,104 @@ bool map::map_() NOEXCEPT
 // Remapping has no effect on logical size, sets map_/capacity_.
 bool map::remap_(size_t size) NOEXCEPT
 {
-    BC_ASSERT(size >= logical_);
+    BC_ASSERT(size >= logical_.load());
 
     // Cannot remap empty file, so expand to minimum capacity if zero.
     if (is_zero(size))
         size = minimum_;
 
-#if !defined(HAVE_MSC) && !defined(MREMAP_MAYMOVE)
+    // Reserved growth is in place, so readers are unaffected.
+    if (reserved_ && size <= reserve_)
+        return extend_(size);
+
+#if !defined(HAVE_MSC)
+    if (anonymous_)
+    {
+        // disk_full: space is set but no code is set with false return.
+        if (!resize_(size))
+            return false;
+
+        // Beyond its reservation anonymous memory is copied. It is not shared
+        // with the file, so writes to the prior mapping after the copy would
+        // be lost. Readers must drain (remapping_ set).
+        drain_();
+
+        // The prior mapping is written back before it can be reclaimed, so
+        // that it is persisted even if the new mapping fails.
+        if (!write_())
+            set_first_code(error::flush_failure);
+
+        // The prior (drained) epoch is retired and unmapped upon publish.
+        const auto prior = memory_map_;
+        memory_map_ = allocate_(size);
+        if (memory_map_ != MAP_FAILED)
+            std::memcpy(memory_map_, prior, capacity_);
+
+        const auto result = finalize_(size);
+        remapping_.store(false);
+        return result;
+    }
+#endif
+
+#if !defined(HAVE_MSC) && defined(MREMAP_MAYMOVE)
+    // disk_full: space is set but no code is set with false return.
+    if (!resize_(size))
+        return false;
+
+    // Map anew, the prior mapping remains valid for its pinned readers. Both
+    // map the same file pages, so writes are visible through either mapping.
+    // A reserved (prior) epoch unmaps its entire reservation once drained.
+    reserved_ = false;
+    memory_map_ = pointer_cast<uint8_t>(::mmap(nullptr, size,
+        PROT_READ | PROT_WRITE, MAP_SHARED, opened_, 0));
+
+    return finalize_(size);
+#else
+    #if defined(HAVE_MSC)
+    // disk_full: space is set but no code is set with false return.
+    if (!resize_(size))
+        return false;
+
+    // Remap is in place, so readers must drain (remapping_ is set).
+    drain_();
+
+    // mman-win32 mremap hack (umap/map) requires flags and file descriptor.
+    memory_map_ = pointer_cast<uint8_t>(::mremap_(memory_map_, capacity_, size,
+        PROT_READ | PROT_WRITE, MAP_SHARED, opened_));
+
+    // The prior mapping was replaced in place (not to be unmapped).
+    current_->assign(nullptr, zero);
+    current_ = nullptr;
+    #else
+    // Remap is in place, so readers must drain (remapping_ is set).
+    drain_();
+
     // macOS: unmap before ftruncate sets new size.
     if (!unmap_())
+    {
+        remapping_.store(false);
         return false;
+    }
 
     // disk_full: unmap(ok), resize(fail for space), map(ok), return false.
     // disk_full: if second unmap fails then code is set, and false return.
     if (!resize_(size))
     {
         /* bool */ map::map_();
+        remapping_.store(false);
         return false;
     }
-#else
-    // disk_full: space is set but no code is set with false return.
-    if (!resize_(size))
-        return false;
-#endif
 
-#if defined(HAVE_MSC)
-    // mman-win32 mremap hack (umap/map) requires flags and file descriptor.
-    memory_map_ = pointer_cast<uint8_t>(::mremap_(memory_map_, capacity_, size,
-        PROT_READ | PROT_WRITE, MAP_SHARED, opened_));
-#elif defined(MREMAP_MAYMOVE)
-    memory_map_ = pointer_cast<uint8_t>(::mremap(memory_map_, capacity_, size,
-        MREMAP_MAYMOVE));
-#else
     // macOS: does not define mremap or MREMAP_MAYMOVE.
     // TODO: see "MREMAP_MAYMOVE" in sqlite for map extension technique.
     memory_map_ = pointer_cast<uint8_t>(::mmap(nullptr, size,
         PROT_READ | PROT_WRITE, MAP_SHARED, opened_, 0));
-#endif
+    #endif
 
-    return finalize_(size);
+    const auto result = finalize_(size);
+    remapping_.store(false);
+    return result;
+#endif
 }
 
 // disk_full: space is set but no code is set with false return.
@@ -459,7 +706,7 @@ bool map::resize_(size_t size) NOEXCEPT
         // Disk full is the only restartable store failure (leave mapped).
         if (errno == ENOSPC)
         {
-            set_disk_space(size - logical_);
+            set_disk_space(size - logical_.load());
             return false;
         }
 
@@ -471,22 +718,80 @@ bool map::resize_(size_t size) NOEXCEPT
     return true;
 }
 
+// Extend failure results in unmapped.
+// Extends the mapping within its reservation, base (and epoch) unchanged.
+bool map::extend_(size_t size) NOEXCEPT
+{
+#if defined(HAVE_MSC)
+    return false;
+#else
+    // disk_full: space is set but no code is set with false return.
+    if (!resize_(size))
+        return false;
+
+    // Mapped pages cover capacity to page end, so map from next page.
+    const auto page = page_size();
+    const auto start = is_zero(page) ? capacity_ :
+        ceilinged_divide(capacity_, page) * page;
+
+    if (start < size)
+    {
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+        const auto address = memory_map_ + start;
+        BC_POP_WARNING()
+
+        // Replaces reserved (inaccessible) pages, not mapped pages. Anonymous
+        // pages are committed in place, as they are not mapped from the file.
+        const auto failed = anonymous_ ?
+            ::mprotect(address, size - start, PROT_READ | PROT_WRITE) == fail :
+            ::mmap(address, size - start, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_FIXED, opened_,
+                possible_narrow_sign_cast<off_t>(start)) == MAP_FAILED;
+
+        if (failed)
+        {
+            set_first_code(error::mmap_failure);
+            unmap_();
+            return false;
+        }
+
+        // The new pages are a distinct mapping, so do not inherit advice.
+        if (advice_ != advice_t::normal)
+            /* bool */ advise_(start, size - start, advice_);
+    }
+
+    capacity_ = size;
+    return true;
+#endif
+}
+
 // Finalize failure results in unmapped.
 bool map::finalize_(size_t size) NOEXCEPT
 {
     if (memory_map_ == MAP_FAILED)
     {
         loaded_ = false;
+        reserved_ = false;
         capacity_ = zero;
         memory_map_ = {};
 
+        // Unpublish, any prior mapping is retired.
+        epoch_.store(nullptr);
+        current_ = nullptr;
+
         // mmap or mremap failure (not mapped).
         set_first_code(error::mmap_failure);
         return false;
     }
 
-    // TODO: madvise with large length value fails on linux, does 0 imply all?
-    if (::madvise(memory_map_, 0, MADV_RANDOM) == fail)
+    // Publish before advice, so that failure unmaps the new mapping.
+    publish_(size);
+
+    // Advice applies to mapped pages, so covers the full capacity (a zero
+    // length is a no-op). Normal is the kernel default, so is not applied.
+    // Hugepage advice is best effort.
+    if (advice_ != advice_t::normal && !advise_(zero, size, advice_) &&
+        advice_ != advice_t::hugepage)
     {
         set_first_code(error::madvise_failure);
         unmap_();
@@ -498,6 +803,166 @@ bool map::finalize_(size_t size) NOEXCEPT
     return true;
 }
 
+bool map::advise_(size_t offset, size_t length,
+    advice_t advice) const NOEXCEPT
+{
+    int native{};
+    switch (advice)
+    {
+        case advice_t::random:
+            native = MADV_RANDOM;
+            break;
+        case advice_t::sequential:
+            native = MADV_SEQUENTIAL;
+            break;
+        case advice_t::willneed:
+            native = MADV_WILLNEED;
+            break;
+        case advice_t::hugepage:
+#if defined(MADV_HUGEPAGE)
+            native = MADV_HUGEPAGE;
+            break;
+#else
+            return false;
+#endif
+        default:
+        case advice_t::normal:
+            native = MADV_NORMAL;
+    }
+
+    // Advice address must be page aligned (map is page aligned).
+    const auto page = page_size();
+    const auto start = is_zero(page) ? offset : (offset / page) * page;
+
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    return ::madvise(memory_map_ + start, length + (offset - start), native)
+        != fail;
+    BC_POP_WARNING()
+}
+
+// Map private memory, with best effort transparent huge page advice.
+// Reserve address space beyond size, within which memory grows in place.
+// Reservation failure falls back to unreserved memory of size.
+uint8_t* map::allocate_(size_t size) NOEXCEPT
+{
+    reserved_ = false;
+    const auto reserve = is_add_overflow(size, anonymous_reservation) ? size :
+        std::max(reservation_, size + anonymous_reservation);
+
+    auto memory = ::mmap(nullptr, reserve, PROT_NONE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (memory != MAP_FAILED)
+    {
+        if (::mprotect(memory, size, PROT_READ | PROT_WRITE) != fail)
+        {
+            reserved_ = true;
+            reserve_ = reserve;
+        }
+        else
+        {
+            ::munmap(memory, reserve);
+            memory = MAP_FAILED;
+        }
+    }
+
+    if (memory == MAP_FAILED)
+        memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+#if defined(MADV_HUGEPAGE)
+    if (memory != MAP_FAILED)
+        ::madvise(memory, reserved_ ? reserve_ : size, MADV_HUGEPAGE);
+#endif
+
+    return pointer_cast<uint8_t>(memory);
+}
+
+// Read the logical size of the file into memory (end of file is failure).
+bool map::read_() NOEXCEPT
+{
+    return file::read(opened_, memory_map_, logical_.load());
+}
+
+// Write the logical size of memory to the file (not synchronized).
+bool map::write_() NOEXCEPT
+{
+    return file::write(opened_, memory_map_, logical_.load());
+}
+
+// private, epoch utilities, not thread safe
+// ----------------------------------------------------------------------------
+
+// Publish memory_map_ as a new epoch, retiring any current.
+void map::publish_(size_t size) NOEXCEPT
+{
+    // A reserved epoch is unmapped over its entire reservation.
+    auto& next = next_epoch_();
+    next.assign(memory_map_, reserved_ ? reserve_ : size);
+    current_ = &next;
+    epoch_.store(current_);
+
+    // Reclaim any retired epoch that has already drained.
+    /* bool */ reclaim_();
+}
+
+// Unpublish the current epoch and wait until its readers have drained.
+void map::drain_() NOEXCEPT
+{
+    BC_ASSERT(!is_null(current_));
+
+    remapping_.store(true);
+    epoch_.store(nullptr);
+
+    while (!current_->is_drained())
+        std::this_thread::yield();
+}
+
+// Unmap each retired and drained epoch (pinning fails against a retired epoch,
+// so once drained it cannot be pinned again until republished).
+bool map::reclaim_() NOEXCEPT
+{
+    auto success = true;
+    for (auto& prior: epochs_)
+    {
+        if (&prior == current_ || is_null(prior.memory()) ||
+            !prior.is_drained())
+            continue;
+
+        success &= (::munmap(prior.memory(), prior.capacity()) != fail);
+        prior.assign(nullptr, zero);
+    }
+
+    return success;
+}
+
+// True if any mapped epoch is pinned.
+bool map::is_pinned_() const NOEXCEPT
+{
+    return std::any_of(epochs_.begin(), epochs_.end(),
+        [](const epoch& value) NOEXCEPT
+        {
+            return !is_null(value.memory()) && !value.is_drained();
+        });
+}
+
+// Obtain an unused epoch, waiting on retired epochs to drain if necessary.
+// This waits only if every epoch is retired and pinned, which requires access
+// pointers that remain in scope over many remaps.
+epoch& map::next_epoch_() NOEXCEPT
+{
+    while (true)
+    {
+        for (auto& next: epochs_)
+            if (&next != current_ && is_null(next.memory()) &&
+                next.is_drained())
+                return next;
+
+        std::this_thread::yield();
+        /* bool */ reclaim_();
+    }
+}
+
 BC_POP_WARNING()
 
 } // namespace database
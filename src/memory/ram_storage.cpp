@@ -0,0 +1,378 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/memory/ram_storage.hpp>
+
+#if defined(HAVE_MSC)
+    #include "mman-win32/mman.h"
+#else
+    #include <unistd.h>
+#endif
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/error.hpp>
+#include <bitcoin/database/file/file.hpp>
+#include <bitcoin/database/memory/recycler.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+using namespace system;
+
+ram_storage::ram_storage(const path& filename, size_t minimum,
+    size_t expansion, size_t, advice_t, bool) NOEXCEPT
+  : filename_(filename),
+    minimum_(minimum),
+    expansion_(expansion)
+{
+}
+
+ram_storage::~ram_storage() NOEXCEPT
+{
+    BC_ASSERT_MSG(!loaded_, "file loaded at destruct");
+    BC_ASSERT_MSG(memory_.empty(), "memory defined at destruct");
+    BC_ASSERT_MSG(is_zero(logical_.load()), "logical nonzero at destruct");
+    BC_ASSERT_MSG(opened_ == file::invalid, "file open at destruct");
+}
+
+const std::filesystem::path& ram_storage::file() const NOEXCEPT
+{
+    return filename_;
+}
+
+code ram_storage::open() NOEXCEPT
+{
+    std::unique_lock field_lock(field_mutex_);
+
+    if (opened_ != file::invalid)
+        return error::open_open;
+
+    if (const auto ec = file::open_ex(opened_, filename_))
+        return ec;
+
+    size_t logical{};
+    const auto ec = file::size_ex(logical, opened_);
+    logical_.store(logical);
+    return ec;
+}
+
+code ram_storage::close() NOEXCEPT
+{
+    std::unique_lock field_lock(field_mutex_);
+
+    if (loaded_)
+        return error::close_loaded;
+
+    if (opened_ == file::invalid)
+        return error::success;
+
+    const auto descriptor = opened_;
+    opened_ = file::invalid;
+    logical_.store(zero);
+
+    return file::close_ex(descriptor);
+}
+
+bool ram_storage::is_open() const NOEXCEPT
+{
+    std::shared_lock field_lock(field_mutex_);
+    return opened_ != file::invalid;
+}
+
+// load, flush, unload.
+// ----------------------------------------------------------------------------
+// Each accessor holds a shared lock on the memory, which is reallocated only
+// upon allocation beyond capacity. Load/unload are precluded while any
+// accessor exists.
+
+code ram_storage::load() NOEXCEPT
+{
+    std::unique_lock field_lock(field_mutex_);
+    std::unique_lock memory_lock(memory_mutex_, std::try_to_lock);
+
+    if (!memory_lock.owns_lock())
+        return error::load_locked;
+
+    if (loaded_)
+        return error::load_loaded;
+
+    const auto logical = logical_.load();
+    memory_.resize(std::max(logical, minimum_));
+
+    if (!file::read(opened_, memory_.data(), logical))
+    {
+        data_chunk{}.swap(memory_);
+        return error::load_failure;
+    }
+
+    loaded_ = true;
+    return error::success;
+}
+
+// Suspend writes before calling.
+code ram_storage::reload() NOEXCEPT
+{
+    std::unique_lock field_lock(field_mutex_);
+    std::unique_lock memory_lock(memory_mutex_, std::try_to_lock);
+
+    if (!memory_lock.owns_lock())
+        return error::reload_locked;
+
+    if (!loaded_)
+        return error::reload_unloaded;
+
+    return error::success;
+}
+
+// Suspend writes before calling.
+code ram_storage::flush() NOEXCEPT
+{
+    // Prevent unload, reallocation.
+    std::shared_lock field_lock(field_mutex_);
+
+    if (!loaded_)
+        return error::flush_unloaded;
+
+    return flush_() ? error::success : error::flush_failure;
+}
+
+code ram_storage::writeback() NOEXCEPT
+{
+    std::shared_lock field_lock(field_mutex_);
+    return loaded_ ? error::success : error::flush_unloaded;
+}
+
+// Suspend writes before calling.
+// Memory is retained upon failure, so that unload may be retried.
+code ram_storage::unload() NOEXCEPT
+{
+    std::unique_lock field_lock(field_mutex_);
+    std::unique_lock memory_lock(memory_mutex_, std::try_to_lock);
+
+    if (!memory_lock.owns_lock())
+        return error::unload_locked;
+
+    if (!loaded_)
+        return error::success;
+
+    if (!flush_())
+        return error::unload_failure;
+
+    data_chunk{}.swap(memory_);
+    loaded_ = false;
+    return error::success;
+}
+
+bool ram_storage::is_loaded() const NOEXCEPT
+{
+    std::shared_lock field_lock(field_mutex_);
+    return loaded_;
+}
+
+// Interface.
+// ----------------------------------------------------------------------------
+
+size_t ram_storage::size() const NOEXCEPT
+{
+    return logical_.load();
+}
+
+size_t ram_storage::capacity() const NOEXCEPT
+{
+    std::shared_lock field_lock(field_mutex_);
+    return memory_.size();
+}
+
+bool ram_storage::truncate(size_t size) NOEXCEPT
+{
+    std::unique_lock field_lock(field_mutex_);
+
+    if (size > logical_.load())
+        return false;
+
+    logical_.store(size);
+    return true;
+}
+
+// Reallocation waits until all accessors are destructed, and will deadlock if
+// any accessor is waiting on allocation (as with in-place map remap).
+size_t ram_storage::allocate(size_t chunk) NOEXCEPT
+{
+    std::unique_lock field_lock(field_mutex_);
+
+    auto logical = logical_.load();
+    if (fault_ || !loaded_ || is_add_overflow(logical, chunk))
+        return storage::eof;
+
+    if (logical + chunk > memory_.size())
+    {
+        // An accessor holds the memory lock and may then take the field lock,
+        // so the memory lock is taken first (as map remap), and then fields
+        // are reread.
+        field_lock.unlock();
+        std::unique_lock memory_lock(memory_mutex_);
+        field_lock.lock();
+
+        logical = logical_.load();
+        if (fault_ || !loaded_ || is_add_overflow(logical, chunk))
+            return storage::eof;
+
+        const auto end = logical + chunk;
+        if (end > memory_.size())
+        {
+            const auto size = to_capacity(end);
+            if (size > memory_.max_size())
+                return storage::eof;
+
+            memory_.resize(size);
+        }
+    }
+
+    logical_.store(logical + chunk);
+    return logical;
+}
+
+bool ram_storage::deallocate(size_t offset, size_t chunk) NOEXCEPT
+{
+    std::unique_lock field_lock(field_mutex_);
+
+    // Only the last allocation can be returned, capacity is retained.
+    if (is_add_overflow(offset, chunk) || offset + chunk != logical_.load())
+        return false;
+
+    logical_.store(offset);
+    return true;
+}
+
+memory_ptr ram_storage::get(size_t offset) const NOEXCEPT
+{
+    // Holds the memory until destruct, the control block is recycled.
+    const auto ptr = std::allocate_shared<access>(recycler<access>{},
+        memory_mutex_);
+
+    if (!loaded_)
+        return nullptr;
+
+    // With offset > size the assignment is negative (stream is exhausted).
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    const auto memory = memory_.data();
+    ptr->assign(memory + offset, memory + logical_.load());
+    BC_POP_WARNING()
+    return ptr;
+}
+
+bool ram_storage::copy(uint8_t* to, size_t offset,
+    size_t size) const NOEXCEPT
+{
+    std::shared_lock memory_lock(memory_mutex_);
+    if (!loaded_ || is_add_overflow(offset, size) ||
+        offset + size > logical_.load())
+        return false;
+
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    std::memcpy(to, memory_.data() + offset, size);
+    BC_POP_WARNING()
+    return true;
+}
+
+bool ram_storage::advise(size_t offset, size_t length,
+    advice_t) const NOEXCEPT
+{
+    std::shared_lock field_lock(field_mutex_);
+    return loaded_ && !is_add_overflow(offset, length) &&
+        (offset + length <= memory_.size());
+}
+
+code ram_storage::get_fault() const NOEXCEPT
+{
+    return error_.load();
+}
+
+size_t ram_storage::get_space() const NOEXCEPT
+{
+    return zero;
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+size_t ram_storage::to_capacity(size_t required) const NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_STATIC_CAST)
+    const auto resize = required * ((expansion_ + 100.0) / 100.0);
+    const auto target = std::max(minimum_, static_cast<size_t>(resize));
+    BC_POP_WARNING()
+
+    BC_ASSERT(target >= required);
+    return target;
+}
+
+// Read-write protected by atomic, write-write protected by field_mutex.
+void ram_storage::set_first_code(const error::error_t& ec) NOEXCEPT
+{
+    if (!fault_)
+    {
+        // fault is not exposed so requires no atomic (fast read).
+        fault_ = true;
+
+        // error is atomic for public read exposure.
+        error_.store(ec);
+    }
+}
+
+// private, not thread safe
+// ----------------------------------------------------------------------------
+
+constexpr auto fail = -1;
+
+// Write back logical size and trim the file to it.
+bool ram_storage::flush_() NOEXCEPT
+{
+    const auto logical = logical_.load();
+
+    if (!file::write(opened_, memory_.data(), logical))
+    {
+        set_first_code(error::flush_failure);
+        return false;
+    }
+
+    const auto success = (::ftruncate(opened_, logical) != fail)
+#if defined(F_FULLFSYNC)
+        && (::fcntl(opened_, F_FULLFSYNC, 0) != fail);
+#else
+        && (::fsync(opened_) != fail);
+#endif
+
+    if (!success)
+        set_first_code(error::fsync_failure);
+
+    return success;
+}
+
+BC_POP_WARNING()
+
+} // namespace database
+} // namespace libbitcoin
@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/memory/striped_counter.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <bitcoin/system.hpp>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+using namespace system;
+
+striped_counter::striped_counter() NOEXCEPT
+{
+}
+
+striped_counter::stripe& striped_counter::get_stripe() NOEXCEPT
+{
+    // Each thread consistently selects one stripe, computed once per thread.
+    static thread_local const auto index = std::hash<std::thread::id>{}(
+        std::this_thread::get_id()) % stripes;
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    return stripes_[index];
+    BC_POP_WARNING()
+}
+
+striped_counter::pin striped_counter::get_pin() NOEXCEPT
+{
+    return pin{ get_stripe() };
+}
+
+bool striped_counter::is_drained() const NOEXCEPT
+{
+    return std::all_of(stripes_.begin(), stripes_.end(),
+        [](const stripe& value) NOEXCEPT
+        {
+            return is_zero(value.count());
+        });
+}
+
+BC_POP_WARNING()
+
+} // namespace database
+} // namespace libbitcoin
@@ -28,78 +28,105 @@ using namespace bc::system;
 
 settings::settings() NOEXCEPT
   : path{ "bitcoin" },
+    reservation{ 0 },
+    archive_threads{ 1 },
+    confirm_threads{ 1 },
+    head_advice{ advice_t::random },
+    anonymous_heads{ false },
+    power2_buckets{ false },
+    rehash_load{ 0 },
+    fingerprint_heads{ false },
 
     // Archives.
 
     header_buckets{ 100 },
     header_size{ 1 },
     header_rate{ 50 },
+    header_advice{ advice_t::random },
 
     input_size{ 1 },
     input_rate{ 50 },
+    input_advice{ advice_t::normal },
 
     output_size{ 1 },
     output_rate{ 50 },
+    output_advice{ advice_t::normal },
 
     point_buckets{ 100 },
     point_size{ 1 },
     point_rate{ 50 },
+    point_advice{ advice_t::random },
+    point_filter{ 0 },
 
     puts_size{ 1 },
     puts_rate{ 50 },
+    puts_advice{ advice_t::normal },
 
     spend_buckets{ 100 },
     spend_size{ 1 },
     spend_rate{ 50 },
+    spend_advice{ advice_t::random },
 
     tx_buckets{ 100 },
     tx_size{ 1 },
     tx_rate{ 50 },
+    tx_advice{ advice_t::random },
+    tx_filter{ 0 },
 
     txs_buckets{ 100 },
     txs_size{ 1 },
     txs_rate{ 50 },
+    txs_advice{ advice_t::random },
 
     // Indexes.
 
     candidate_size{ 1 },
     candidate_rate{ 50 },
+    candidate_advice{ advice_t::normal },
 
     confirmed_size{ 1 },
     confirmed_rate{ 50 },
+    confirmed_advice{ advice_t::normal },
 
     strong_tx_buckets{ 100 },
     strong_tx_size{ 1 },
     strong_tx_rate{ 50 },
+    strong_tx_advice{ advice_t::random },
 
     // Caches.
 
     validated_bk_buckets{ 100 },
     validated_bk_size{ 1 },
     validated_bk_rate{ 50 },
+    validated_bk_advice{ advice_t::random },
 
     validated_tx_buckets{ 100 },
     validated_tx_size{ 1 },
     validated_tx_rate{ 50 },
+    validated_tx_advice{ advice_t::random },
 
     // Optionals.
 
     address_buckets{ 100 },
     address_size{ 1 },
     address_rate{ 50 },
+    address_advice{ advice_t::random },
 
     neutrino_buckets{ 100 },
     neutrino_size{ 1 },
-    neutrino_rate{ 50 }
+    neutrino_rate{ 50 },
+    neutrino_advice{ advice_t::random }
 
     // Caches.
 
     ////bootstrap_size{ 1 },
     ////bootstrap_rate{ 50 },
+    ////bootstrap_advice{ advice_t::random },
 
     ////buffer_buckets{ 100 },
     ////buffer_size{ 1 },
-    ////buffer_rate{ 50 }
+    ////buffer_rate{ 50 },
+    ////buffer_advice{ advice_t::random }
 {
 }
 
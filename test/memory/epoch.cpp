@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(epoch_tests)
+
+using namespace system;
+
+BOOST_AUTO_TEST_CASE(epoch__construct__default__unassigned_drained)
+{
+    const epoch instance{};
+    BOOST_REQUIRE(is_null(instance.memory()));
+    BOOST_REQUIRE_EQUAL(instance.capacity(), zero);
+    BOOST_REQUIRE(instance.is_drained());
+}
+
+BOOST_AUTO_TEST_CASE(epoch__assign__values__expected)
+{
+    data_chunk chunk{ 0x00, 0x01, 0x02 };
+    epoch instance{};
+    instance.assign(chunk.data(), chunk.size());
+    BOOST_REQUIRE_EQUAL(instance.memory(), chunk.data());
+    BOOST_REQUIRE_EQUAL(instance.capacity(), chunk.size());
+}
+
+BOOST_AUTO_TEST_CASE(epoch__is_drained__pinned__false)
+{
+    epoch instance{};
+    auto pin = instance.get_pin();
+    BOOST_REQUIRE(!instance.is_drained());
+    pin.unlock();
+    BOOST_REQUIRE(instance.is_drained());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
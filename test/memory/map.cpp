@@ -356,6 +356,182 @@ BOOST_AUTO_TEST_CASE(map__allocate__no_minimum_expansion__expected_capacity)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(map__advise__unloaded__false)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file);
+    BOOST_REQUIRE(!instance.advise(zero, zero, advice_t::willneed));
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.advise(zero, zero, advice_t::willneed));
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__advise__loaded__expected)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file, 1, 0, 0, advice_t::sequential);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(100), zero);
+    BOOST_REQUIRE(instance.advise(zero, 100, advice_t::willneed));
+    BOOST_REQUIRE(instance.advise(42, 10, advice_t::random));
+    BOOST_REQUIRE(!instance.advise(42, instance.capacity(), advice_t::normal));
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__load__hugepage_advice__success)
+{
+    // Hugepage advice is best effort, so does not fail load.
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file, 1, 0, 0, advice_t::hugepage);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(100), zero);
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__load__anonymous_remapped__persisted)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file, 1, 0, 0, advice_t::random, true);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    auto memory = instance.get(instance.allocate(1));
+    BOOST_REQUIRE(memory);
+    memory->begin()[0] = 0x42;
+    memory.reset();
+
+    // Growth within the reservation is in place.
+    BOOST_REQUIRE_EQUAL(instance.allocate(10000), 1u);
+    memory = instance.get(10000);
+    BOOST_REQUIRE(memory);
+    memory->begin()[0] = 0x24;
+    memory.reset();
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE_EQUAL(instance.size(), 10001u);
+
+    // Reload reads the written back memory.
+    BOOST_REQUIRE(!instance.load());
+    memory = instance.get();
+    BOOST_REQUIRE(memory);
+    BOOST_REQUIRE_EQUAL(memory->begin()[0], 0x42);
+    BOOST_REQUIRE_EQUAL(memory->begin()[10000], 0x24);
+    memory.reset();
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__allocate__anonymous_reserved__in_place)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file, 1, 0, 0, advice_t::random, true);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    auto memory = instance.get(instance.allocate(1));
+    BOOST_REQUIRE(memory);
+    memory->begin()[0] = 0x42;
+
+    // A pinned reader does not preclude growth, and sees the same memory.
+    const auto base = memory->begin();
+    BOOST_REQUIRE_EQUAL(instance.allocate(100000), 1u);
+    BOOST_REQUIRE_EQUAL(instance.get()->begin(), base);
+    BOOST_REQUIRE_EQUAL(memory->begin()[0], 0x42);
+    memory.reset();
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__allocate__anonymous_remap_failure__persisted)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file, 1, 0, 0, advice_t::random, true);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    auto memory = instance.get(instance.allocate(1));
+    BOOST_REQUIRE(memory);
+    memory->begin()[0] = 0x42;
+    memory.reset();
+
+    // Growth beyond any reservation (and file size limit) fails.
+    BOOST_REQUIRE_EQUAL(instance.allocate(power2<size_t>(50u)), storage::eof);
+    BOOST_REQUIRE(!instance.unload());
+
+    // The anonymous memory was written back before it was released.
+    std::ifstream stream(file, std::ios::binary);
+    BOOST_REQUIRE_EQUAL(stream.get(), 0x42);
+    stream.close();
+    BOOST_REQUIRE(!instance.close());
+}
+
+BOOST_AUTO_TEST_CASE(map__flush__anonymous__written)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file, 1, 0, 0, advice_t::random, true);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    auto memory = instance.get(instance.allocate(1));
+    BOOST_REQUIRE(memory);
+    memory->begin()[0] = 0x42;
+    memory.reset();
+    BOOST_REQUIRE(!instance.flush());
+
+    std::ifstream stream(file, std::ios::binary);
+    BOOST_REQUIRE_EQUAL(stream.get(), 0x42);
+    stream.close();
+
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__deallocate__last__true_size_reduced)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(10), zero);
+    BOOST_REQUIRE_EQUAL(instance.allocate(20), 10u);
+    BOOST_REQUIRE(instance.deallocate(10, 20));
+    BOOST_REQUIRE_EQUAL(instance.size(), 10u);
+    BOOST_REQUIRE_EQUAL(instance.allocate(5), 10u);
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__deallocate__not_last__false_unchanged)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(10), zero);
+    BOOST_REQUIRE_EQUAL(instance.allocate(20), 10u);
+    BOOST_REQUIRE(!instance.deallocate(zero, 10));
+    BOOST_REQUIRE(!instance.deallocate(10, 10));
+    BOOST_REQUIRE_EQUAL(instance.size(), 30u);
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 BOOST_AUTO_TEST_CASE(map__get__unloaded__false)
 {
     const std::string file = TEST_PATH;
@@ -380,6 +556,44 @@ BOOST_AUTO_TEST_CASE(map__get__loaded__success)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(map__copy__unloaded__false)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+
+    uint8_t byte{};
+    BOOST_REQUIRE(!instance.copy(&byte, zero, one));
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__copy__loaded__expected)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(2), zero);
+    instance.get()->begin()[0] = 0x42;
+    instance.get()->begin()[1] = 0x24;
+
+    system::data_array<2> bytes{};
+    BOOST_REQUIRE(instance.copy(bytes.data(), zero, two));
+    BOOST_REQUIRE_EQUAL(bytes[0], 0x42);
+    BOOST_REQUIRE_EQUAL(bytes[1], 0x24);
+    BOOST_REQUIRE(instance.copy(bytes.data(), one, one));
+    BOOST_REQUIRE_EQUAL(bytes[0], 0x24);
+
+    // Copy is limited to logical size.
+    BOOST_REQUIRE(!instance.copy(bytes.data(), one, two));
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 BOOST_AUTO_TEST_CASE(map__flush__unloaded__false)
 {
     const std::string file = TEST_PATH;
@@ -404,6 +618,38 @@ BOOST_AUTO_TEST_CASE(map__flush__loaded__true)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(map__writeback__unloaded__flush_unloaded)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE_EQUAL(instance.writeback(), error::flush_unloaded);
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__writeback__appended__success)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE(!instance.writeback());
+    BOOST_REQUIRE_EQUAL(instance.allocate(5000), zero);
+    instance.get(4999)->begin()[0] = 0x42;
+    BOOST_REQUIRE(!instance.writeback());
+    BOOST_REQUIRE(!instance.writeback());
+    BOOST_REQUIRE(instance.truncate(10));
+    BOOST_REQUIRE_EQUAL(instance.allocate(10), 10u);
+    BOOST_REQUIRE(!instance.writeback());
+    BOOST_REQUIRE(!instance.flush());
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 BOOST_AUTO_TEST_CASE(map__write__read__expected)
 {
     constexpr uint64_t expected = 0x0102030405060708_u64;
@@ -442,4 +688,112 @@ BOOST_AUTO_TEST_CASE(map__unload__shared__false)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(map__get__remap__prior_memory_valid)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(1), zero);
+
+    auto memory = instance.get();
+    BOOST_REQUIRE(memory);
+    memory->begin()[0] = 0x42;
+
+#if !defined(HAVE_MSC) && defined(MREMAP_MAYMOVE)
+    // Remap does not wait on (or invalidate) the pinned epoch.
+    BOOST_REQUIRE_EQUAL(instance.allocate(4096), one);
+    BOOST_REQUIRE_EQUAL(instance.allocate(4096), 4097u);
+    BOOST_REQUIRE_EQUAL(memory->begin()[0], 0x42);
+
+    // Prior and current mappings share file pages.
+    memory->begin()[1] = 0x24;
+    BOOST_REQUIRE_EQUAL(instance.get()->begin()[1], 0x24);
+#endif
+
+    memory.reset();
+    BOOST_REQUIRE_EQUAL(instance.get()->begin()[0], 0x42);
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__unload__shared_remapped__false)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    auto memory = instance.get(instance.allocate(1));
+    BOOST_REQUIRE(memory);
+
+#if !defined(HAVE_MSC) && defined(MREMAP_MAYMOVE)
+    // A retired epoch remains pinned.
+    BOOST_REQUIRE_EQUAL(instance.allocate(4096), one);
+    BOOST_REQUIRE_EQUAL(instance.unload(), error::unload_locked);
+#endif
+
+    memory.reset();
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__allocate__reserved__memory_unmoved)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file, 1, 0, 1024 * 1024);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(1), zero);
+
+    auto memory = instance.get();
+    BOOST_REQUIRE(memory);
+    memory->begin()[0] = 0x42;
+
+#if !defined(HAVE_MSC)
+    // Growth within the reservation extends the mapping in place.
+    BOOST_REQUIRE_EQUAL(instance.allocate(4096), one);
+    BOOST_REQUIRE_EQUAL(instance.allocate(4096), 4097u);
+    BOOST_REQUIRE_EQUAL(instance.get()->begin(), memory->begin());
+    BOOST_REQUIRE_EQUAL(instance.get()->begin()[0], 0x42);
+    memory->begin()[8192] = 0x24;
+    BOOST_REQUIRE_EQUAL(instance.get(8192)->begin()[0], 0x24);
+#endif
+
+    memory.reset();
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__allocate__beyond_reservation__expected)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    map instance(file, 1, 0, 4096);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(1), zero);
+    instance.get()->begin()[0] = 0x42;
+
+    // Growth beyond the reservation falls back to remap.
+    BOOST_REQUIRE_EQUAL(instance.allocate(8192), one);
+    BOOST_REQUIRE_EQUAL(instance.size(), 8193u);
+    BOOST_REQUIRE_EQUAL(instance.get()->begin()[0], 0x42);
+    instance.get(8192)->begin()[0] = 0x24;
+    BOOST_REQUIRE(!instance.unload());
+
+    // Reload restores the reservation.
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.get()->begin()[0], 0x42);
+    BOOST_REQUIRE_EQUAL(instance.get(8192)->begin()[0], 0x24);
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
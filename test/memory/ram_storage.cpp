@@ -0,0 +1,245 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+struct ram_storage_setup_fixture
+{
+    DELETE_COPY_MOVE(ram_storage_setup_fixture);
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+    ram_storage_setup_fixture() NOEXCEPT
+    {
+        BOOST_REQUIRE(test::clear(test::directory));
+    }
+
+    ~ram_storage_setup_fixture() NOEXCEPT
+    {
+        BOOST_REQUIRE(test::clear(test::directory));
+    }
+
+    BC_POP_WARNING()
+};
+
+BOOST_FIXTURE_TEST_SUITE(ram_storage_tests, ram_storage_setup_fixture)
+
+BOOST_AUTO_TEST_CASE(ram_storage__file__always__expected)
+{
+    const std::string file = TEST_PATH;
+    ram_storage instance(file);
+    BOOST_REQUIRE_EQUAL(instance.file(), file);
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(ram_storage__open__opened__open_open)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    ram_storage instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(instance.is_open());
+    BOOST_REQUIRE_EQUAL(instance.open(), error::open_open);
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.is_open());
+}
+
+BOOST_AUTO_TEST_CASE(ram_storage__close__loaded__close_loaded)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    ram_storage instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE(instance.is_loaded());
+    BOOST_REQUIRE_EQUAL(instance.load(), error::load_loaded);
+    BOOST_REQUIRE_EQUAL(instance.close(), error::close_loaded);
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.is_loaded());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(ram_storage__get__unloaded__null)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    ram_storage instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.get());
+    BOOST_REQUIRE_EQUAL(instance.allocate(1), storage::eof);
+    BOOST_REQUIRE_EQUAL(instance.flush(), error::flush_unloaded);
+    BOOST_REQUIRE_EQUAL(instance.writeback(), error::flush_unloaded);
+    BOOST_REQUIRE_EQUAL(instance.reload(), error::reload_unloaded);
+    BOOST_REQUIRE(!instance.close());
+}
+
+BOOST_AUTO_TEST_CASE(ram_storage__copy__loaded__expected)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    ram_storage instance(file);
+
+    uint8_t byte{};
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.copy(&byte, zero, one));
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(2), zero);
+    instance.get(1)->begin()[0] = 0x42;
+    BOOST_REQUIRE(instance.copy(&byte, one, one));
+    BOOST_REQUIRE_EQUAL(byte, 0x42);
+
+    // Copy is limited to logical size.
+    BOOST_REQUIRE(!instance.copy(&byte, two, one));
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(ram_storage__allocate__loaded__expected)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    ram_storage instance(file, 10, 50);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 10u);
+    BOOST_REQUIRE_EQUAL(instance.allocate(5), zero);
+    BOOST_REQUIRE_EQUAL(instance.allocate(10), 5u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 15u);
+    BOOST_REQUIRE_GE(instance.capacity(), 15u);
+    BOOST_REQUIRE(instance.deallocate(5, 10));
+    BOOST_REQUIRE(!instance.deallocate(0, 1));
+    BOOST_REQUIRE_EQUAL(instance.size(), 5u);
+    BOOST_REQUIRE(instance.truncate(2));
+    BOOST_REQUIRE(!instance.truncate(3));
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), zero);
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(ram_storage__allocate__accessed__fields_not_blocked)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    ram_storage instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(1), zero);
+    auto memory = instance.get();
+    BOOST_REQUIRE(memory);
+
+    // Growth waits on the accessor, which is not blocked from fields.
+    std::atomic<size_t> offset{ storage::eof };
+    std::thread grow([&]() NOEXCEPT { offset.store(instance.allocate(100)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    BOOST_REQUIRE(instance.is_loaded());
+    BOOST_REQUIRE_GE(instance.capacity(), one);
+    BOOST_REQUIRE(instance.advise(zero, one, advice_t::random));
+    memory.reset();
+    grow.join();
+
+    BOOST_REQUIRE_EQUAL(offset.load(), one);
+    BOOST_REQUIRE_EQUAL(instance.size(), 101u);
+    BOOST_REQUIRE_GE(instance.capacity(), 101u);
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(ram_storage__unload__accessed__unload_locked)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    ram_storage instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    auto memory = instance.get();
+    BOOST_REQUIRE(memory);
+    BOOST_REQUIRE_EQUAL(instance.unload(), error::unload_locked);
+    memory.reset();
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(ram_storage__unload__written__persisted)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    ram_storage instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(2), zero);
+    auto memory = instance.get();
+    BOOST_REQUIRE(memory);
+    BOOST_REQUIRE_EQUAL(memory->size(), 2);
+    memory->begin()[0] = 0x42;
+    memory->begin()[1] = 0x24;
+    memory.reset();
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE(!instance.load());
+    memory = instance.get(1);
+    BOOST_REQUIRE(memory);
+    BOOST_REQUIRE_EQUAL(memory->begin()[0], 0x24);
+    memory.reset();
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(ram_storage__flush__written__persisted)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    ram_storage instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(1), zero);
+    instance.get()->begin()[0] = 0x42;
+    BOOST_REQUIRE(!instance.flush());
+
+    size_t size{};
+    BOOST_REQUIRE(file::size(size, file));
+    BOOST_REQUIRE_EQUAL(size, 1u);
+
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(ram_storage__advise__loaded__expected)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+    ram_storage instance(file, 100);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.advise(zero, 1, advice_t::random));
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE(instance.advise(zero, 100, advice_t::random));
+    BOOST_REQUIRE(!instance.advise(zero, 101, advice_t::random));
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
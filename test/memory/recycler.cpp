@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(recycler_tests)
+
+BOOST_AUTO_TEST_CASE(recycler__allocate__deallocated__recycled)
+{
+    recycler<uint64_t> instance{};
+    const auto block = instance.allocate(one);
+    BOOST_REQUIRE(block != nullptr);
+    instance.deallocate(block, one);
+    BOOST_REQUIRE_EQUAL(instance.allocate(one), block);
+    instance.deallocate(block, one);
+}
+
+BOOST_AUTO_TEST_CASE(recycler__allocate__multiple__not_recycled)
+{
+    recycler<uint64_t> instance{};
+    const auto block = instance.allocate(two);
+    BOOST_REQUIRE(block != nullptr);
+    instance.deallocate(block, two);
+}
+
+BOOST_AUTO_TEST_CASE(recycler__equality__rebound__true)
+{
+    const recycler<uint64_t> instance{};
+    const recycler<uint8_t> rebound{ instance };
+    BOOST_REQUIRE(instance == rebound);
+}
+
+BOOST_AUTO_TEST_CASE(recycler__allocate_shared__value__expected)
+{
+    const auto ptr = std::allocate_shared<uint64_t>(recycler<uint64_t>{}, 42u);
+    BOOST_REQUIRE(ptr);
+    BOOST_REQUIRE_EQUAL(*ptr, 42u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
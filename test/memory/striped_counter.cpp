@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(striped_counter_tests)
+
+using namespace system;
+
+BOOST_AUTO_TEST_CASE(striped_counter__construct__default__drained)
+{
+    const striped_counter instance{};
+    BOOST_REQUIRE(instance.is_drained());
+}
+
+BOOST_AUTO_TEST_CASE(striped_counter__get_stripe__same_thread__same_stripe)
+{
+    striped_counter instance{};
+    BOOST_REQUIRE_EQUAL(&instance.get_stripe(), &instance.get_stripe());
+}
+
+BOOST_AUTO_TEST_CASE(striped_counter__is_drained__shared_lock__false)
+{
+    striped_counter instance{};
+    auto& stripe = instance.get_stripe();
+    {
+        std::shared_lock lock(stripe);
+        BOOST_REQUIRE_EQUAL(stripe.count(), one);
+        BOOST_REQUIRE(!instance.is_drained());
+    }
+
+    BOOST_REQUIRE_EQUAL(stripe.count(), zero);
+    BOOST_REQUIRE(instance.is_drained());
+}
+
+BOOST_AUTO_TEST_CASE(striped_counter__is_drained__accessor__released)
+{
+    striped_counter instance{};
+    auto access = std::make_shared<accessor<striped_counter::stripe>>(
+        instance.get_stripe());
+    BOOST_REQUIRE(!instance.is_drained());
+    access.reset();
+    BOOST_REQUIRE(instance.is_drained());
+}
+
+BOOST_AUTO_TEST_CASE(striped_counter__is_drained__other_thread_released__true)
+{
+    striped_counter instance{};
+    std::shared_lock lock(instance.get_stripe());
+    BOOST_REQUIRE(!instance.is_drained());
+
+    // Unlock may occur on a thread other than the locking thread.
+    std::thread([&]() NOEXCEPT { lock.unlock(); }).join();
+    BOOST_REQUIRE(instance.is_drained());
+}
+
+BOOST_AUTO_TEST_CASE(striped_counter__get_pin__released__drained)
+{
+    striped_counter instance{};
+    {
+        const auto pin = instance.get_pin();
+        BOOST_REQUIRE(pin.owns_lock());
+        BOOST_REQUIRE_EQUAL(instance.get_stripe().count(), one);
+        BOOST_REQUIRE(!instance.is_drained());
+    }
+
+    BOOST_REQUIRE(instance.is_drained());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
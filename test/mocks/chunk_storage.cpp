@@ -39,7 +39,7 @@ chunk_storage::chunk_storage(system::data_chunk& reference) NOEXCEPT
 }
 
 chunk_storage::chunk_storage(const std::filesystem::path& filename,
-    size_t, size_t) NOEXCEPT
+    size_t, size_t, size_t, advice_t, bool) NOEXCEPT
   : path_{ filename }, local_{}, buffer_{ local_ }
 {
 }
@@ -74,6 +74,11 @@ code chunk_storage::flush() NOEXCEPT
     return error::success;
 }
 
+code chunk_storage::writeback() NOEXCEPT
+{
+    return error::success;
+}
+
 code chunk_storage::unload() NOEXCEPT
 {
     return error::success;
@@ -121,6 +126,18 @@ size_t chunk_storage::allocate(size_t chunk) NOEXCEPT
     return link;
 }
 
+bool chunk_storage::deallocate(size_t offset, size_t chunk) NOEXCEPT
+{
+    std::unique_lock field_lock(field_mutex_);
+    if (system::is_add_overflow(offset, chunk) ||
+        offset + chunk != buffer_.size())
+        return false;
+
+    std::unique_lock map_lock(map_mutex_);
+    buffer_.resize(offset);
+    return true;
+}
+
 memory_ptr chunk_storage::get(size_t offset) const NOEXCEPT
 {
     const auto ptr = std::make_shared<accessor<std::shared_mutex>>(map_mutex_);
@@ -133,6 +150,25 @@ memory_ptr chunk_storage::get(size_t offset) const NOEXCEPT
     return ptr;
 }
 
+bool chunk_storage::copy(uint8_t* to, size_t offset,
+    size_t size) const NOEXCEPT
+{
+    std::shared_lock map_lock(map_mutex_);
+    if (system::is_add_overflow(offset, size) || offset + size > this->size())
+        return false;
+
+    std::copy_n(std::next(buffer_.data(), offset), size, to);
+    return true;
+}
+
+bool chunk_storage::advise(size_t offset, size_t length,
+    advice_t) const NOEXCEPT
+{
+    std::shared_lock field_lock(field_mutex_);
+    return !system::is_add_overflow(offset, length) &&
+        offset + length <= buffer_.size();
+}
+
 code chunk_storage::get_fault() const NOEXCEPT
 {
     return {};
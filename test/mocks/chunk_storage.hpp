@@ -32,7 +32,8 @@ public:
     chunk_storage() NOEXCEPT;
     chunk_storage(system::data_chunk& reference) NOEXCEPT;
     chunk_storage(const std::filesystem::path& filename, size_t minimum=1,
-        size_t expansion=0) NOEXCEPT;
+        size_t expansion=0, size_t reservation=0,
+        advice_t advice=advice_t::random, bool anonymous=false) NOEXCEPT;
 
     // test side door.
     system::data_chunk& buffer() NOEXCEPT;
@@ -43,13 +44,18 @@ public:
     code load() NOEXCEPT override;
     code reload() NOEXCEPT override;
     code flush() NOEXCEPT override;
+    code writeback() NOEXCEPT override;
     code unload() NOEXCEPT override;
     const std::filesystem::path& file() const NOEXCEPT override;
     size_t capacity() const NOEXCEPT override;
     size_t size() const NOEXCEPT override;
     bool truncate(size_t size) NOEXCEPT override;
     size_t allocate(size_t chunk) NOEXCEPT override;
+    bool deallocate(size_t offset, size_t chunk) NOEXCEPT override;
     memory_ptr get(size_t offset=zero) const NOEXCEPT override;
+    bool copy(uint8_t* to, size_t offset, size_t size) const NOEXCEPT override;
+    bool advise(size_t offset, size_t length,
+        advice_t advice) const NOEXCEPT override;
     code get_fault() const NOEXCEPT override;
     size_t get_space() const NOEXCEPT override;
 
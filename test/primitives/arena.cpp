@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(arena_tests)
+
+using namespace system;
+using link5 = linkage<5>;
+using slab_table = arraymap<link5, max_size_t>;
+using slab_arena = arena<slab_table>;
+
+BOOST_AUTO_TEST_CASE(arena__allocate__default_reservation__exact)
+{
+    data_chunk head_file;
+    data_chunk body_file;
+    test::chunk_storage head_store{ head_file };
+    test::chunk_storage body_store{ body_file };
+    slab_table table{ head_store, body_store };
+    slab_arena instance{ table };
+    BOOST_REQUIRE_EQUAL(instance.allocate(10), zero);
+    BOOST_REQUIRE_EQUAL(instance.allocate(5), 10u);
+    BOOST_REQUIRE_EQUAL(instance.remaining(), zero);
+    BOOST_REQUIRE_EQUAL(body_file.size(), 15u);
+}
+
+BOOST_AUTO_TEST_CASE(arena__allocate__terminal__terminal_unchanged)
+{
+    data_chunk head_file;
+    data_chunk body_file;
+    test::chunk_storage head_store{ head_file };
+    test::chunk_storage body_store{ body_file };
+    slab_table table{ head_store, body_store };
+    slab_arena instance{ table, 100 };
+    BOOST_REQUIRE(instance.allocate(link5::terminal).is_terminal());
+    BOOST_REQUIRE(body_file.empty());
+}
+
+BOOST_AUTO_TEST_CASE(arena__allocate__within_reservation__one_table_allocation)
+{
+    data_chunk head_file;
+    data_chunk body_file;
+    test::chunk_storage head_store{ head_file };
+    test::chunk_storage body_store{ body_file };
+    slab_table table{ head_store, body_store };
+    slab_arena instance{ table, 100 };
+    BOOST_REQUIRE_EQUAL(instance.allocate(10), zero);
+    BOOST_REQUIRE_EQUAL(body_file.size(), 100u);
+    BOOST_REQUIRE_EQUAL(instance.allocate(20), 10u);
+    BOOST_REQUIRE_EQUAL(instance.allocate(70), 30u);
+    BOOST_REQUIRE_EQUAL(instance.remaining(), zero);
+    BOOST_REQUIRE_EQUAL(body_file.size(), 100u);
+}
+
+BOOST_AUTO_TEST_CASE(arena__allocate__exceeds_remaining__contiguous_reservation)
+{
+    data_chunk head_file;
+    data_chunk body_file;
+    test::chunk_storage head_store{ head_file };
+    test::chunk_storage body_store{ body_file };
+    slab_table table{ head_store, body_store };
+    slab_arena instance{ table, 100 };
+    BOOST_REQUIRE_EQUAL(instance.allocate(90), zero);
+
+    // Remainder is at end of body, so is returned before reservation.
+    BOOST_REQUIRE_EQUAL(instance.allocate(20), 90u);
+    BOOST_REQUIRE_EQUAL(instance.remaining(), 80u);
+    BOOST_REQUIRE_EQUAL(body_file.size(), 190u);
+}
+
+BOOST_AUTO_TEST_CASE(arena__release__at_end__true_returned)
+{
+    data_chunk head_file;
+    data_chunk body_file;
+    test::chunk_storage head_store{ head_file };
+    test::chunk_storage body_store{ body_file };
+    slab_table table{ head_store, body_store };
+    slab_arena instance{ table, 100 };
+    BOOST_REQUIRE_EQUAL(instance.allocate(10), zero);
+    BOOST_REQUIRE(instance.release());
+    BOOST_REQUIRE_EQUAL(instance.remaining(), zero);
+    BOOST_REQUIRE_EQUAL(body_file.size(), 10u);
+}
+
+BOOST_AUTO_TEST_CASE(arena__release__not_at_end__false_padded)
+{
+    data_chunk head_file;
+    data_chunk body_file;
+    test::chunk_storage head_store{ head_file };
+    test::chunk_storage body_store{ body_file };
+    slab_table table{ head_store, body_store };
+    slab_arena instance{ table, 100 };
+    BOOST_REQUIRE_EQUAL(instance.allocate(10), zero);
+    BOOST_REQUIRE_EQUAL(table.allocate(5), 100u);
+    BOOST_REQUIRE(!instance.release());
+    BOOST_REQUIRE_EQUAL(instance.remaining(), zero);
+    BOOST_REQUIRE_EQUAL(body_file.size(), 105u);
+}
+
+BOOST_AUTO_TEST_CASE(arena__destruct__at_end__returned)
+{
+    data_chunk head_file;
+    data_chunk body_file;
+    test::chunk_storage head_store{ head_file };
+    test::chunk_storage body_store{ body_file };
+    slab_table table{ head_store, body_store };
+    {
+        slab_arena instance{ table, 100 };
+        BOOST_REQUIRE_EQUAL(instance.allocate(42), zero);
+    }
+
+    BOOST_REQUIRE_EQUAL(body_file.size(), 42u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(cursor_tests)
+
+using namespace system;
+
+BOOST_AUTO_TEST_CASE(cursor__self__terminal_start__terminal)
+{
+    using link = linkage<4>;
+    using key = data_array<2>;
+    using record_cursor = cursor<link, key, 1>;
+
+    constexpr key key2{ 0x1a, 0x2a };
+    data_chunk data{ 0xff, 0xff, 0xff, 0xff, 0x1a, 0x2a, 0xee };
+    test::chunk_storage file{ data };
+    const record_cursor::manager body{ file };
+    record_cursor cursor{ body, link::terminal, key2 };
+    BOOST_REQUIRE(cursor.self().is_terminal());
+    BOOST_REQUIRE(!cursor.advance());
+}
+
+BOOST_AUTO_TEST_CASE(cursor__self__beyond_logical__terminal)
+{
+    using link = linkage<1>;
+    using key = data_array<2>;
+    using record_cursor = cursor<link, key, 1>;
+
+    constexpr key key2{ 0x1a, 0x2a };
+    data_chunk data{ 0x01, 0x1a, 0x2a, 0xee };
+    test::chunk_storage file{ data };
+    const record_cursor::manager body{ file };
+    record_cursor cursor{ body, 1, key2 };
+    BOOST_REQUIRE(cursor.self().is_terminal());
+}
+
+BOOST_AUTO_TEST_CASE(cursor__advance__record__expected)
+{
+    using link = linkage<1>;
+    using key = data_array<2>;
+    using record_cursor = cursor<link, key, 1>;
+
+    constexpr key key2{ 0x1a, 0x2a };
+    data_chunk data
+    {
+        0x01, 0x1a, 0x2a, 0xee,
+        0x02, 0xcc, 0xcc, 0xee,
+        0xff, 0x1a, 0x2a, 0xee
+    };
+    test::chunk_storage file{ data };
+    const record_cursor::manager body{ file };
+    record_cursor cursor{ body, 0, key2 };
+
+    // First link is zero, matched.
+    BOOST_REQUIRE_EQUAL(cursor.self(), 0x00u);
+
+    // Skips link 0x01 (not matched), sets self to 0x02, matched.
+    BOOST_REQUIRE(cursor.advance());
+    BOOST_REQUIRE_EQUAL(cursor.self(), 0x02u);
+
+    // No more matches.
+    BOOST_REQUIRE(!cursor.advance());
+    BOOST_REQUIRE_EQUAL(cursor.self(), link::terminal);
+}
+
+BOOST_AUTO_TEST_CASE(cursor__advance__slab__expected)
+{
+    using link = linkage<1>;
+    using key = data_array<2>;
+    using slab_cursor = cursor<link, key>;
+
+    // Slab links are byte offsets, slabs are of arbitrary size.
+    constexpr key key2{ 0x1a, 0x2a };
+    data_chunk data
+    {
+        0x05, 0xcc, 0xcc, 0xee, 0xee,
+        0x09, 0x1a, 0x2a, 0xee,
+        0xff, 0x1a, 0x2a
+    };
+    test::chunk_storage file{ data };
+    const slab_cursor::manager body{ file };
+    slab_cursor cursor{ body, 0, key2 };
+    BOOST_REQUIRE_EQUAL(cursor.self(), 0x05u);
+    BOOST_REQUIRE(cursor.advance());
+    BOOST_REQUIRE_EQUAL(cursor.self(), 0x09u);
+    BOOST_REQUIRE(!cursor.advance());
+    BOOST_REQUIRE(cursor.self().is_terminal());
+}
+
+BOOST_AUTO_TEST_CASE(cursor__advance__repinned__next_reread)
+{
+    using link = linkage<1>;
+    using key = data_array<2>;
+    using record_cursor = cursor<link, key, 1>;
+
+    constexpr key key2{ 0x1a, 0x2a };
+    data_chunk data
+    {
+        0x01, 0x1a, 0x2a, 0xee,
+        0x02, 0xcc, 0xcc, 0xee,
+        0xff, 0x1a, 0x2a, 0xee
+    };
+    test::chunk_storage file{ data };
+    const record_cursor::manager body{ file };
+    striped_counter readers{};
+    size_t pins{};
+    record_cursor cursor{ body, 0, key2, readers.get_pin(), [&]() NOEXCEPT
+    {
+        ++pins;
+        return readers.get_pin();
+    } };
+
+    // Resizing is not pinned between advances.
+    BOOST_REQUIRE_EQUAL(cursor.self(), 0x00u);
+    BOOST_REQUIRE(readers.is_drained());
+
+    // Relink self (as a split) to terminal, next is reread once pinned.
+    file.buffer().front() = 0xff;
+    BOOST_REQUIRE(!cursor.advance());
+    BOOST_REQUIRE(cursor.self().is_terminal());
+    BOOST_REQUIRE_EQUAL(pins, 1u);
+    BOOST_REQUIRE(readers.is_drained());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(filter_tests)
+
+using namespace system;
+using key = data_array<10>;
+using key_filter = filter<key>;
+
+static key to_key(uint32_t value) NOEXCEPT
+{
+    key out{};
+    out[0] = narrow_cast<uint8_t>(value);
+    out[1] = narrow_cast<uint8_t>(value >> 8);
+    out[2] = narrow_cast<uint8_t>(value >> 16);
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(filter__enabled__zero__false)
+{
+    const key_filter instance{ 0 };
+    BOOST_REQUIRE(!instance.enabled());
+}
+
+BOOST_AUTO_TEST_CASE(filter__enabled__less_than_word__false)
+{
+    const key_filter instance{ 7 };
+    BOOST_REQUIRE(!instance.enabled());
+}
+
+BOOST_AUTO_TEST_CASE(filter__enabled__word__true)
+{
+    const key_filter instance{ 8 };
+    BOOST_REQUIRE(instance.enabled());
+}
+
+BOOST_AUTO_TEST_CASE(filter__contains__disabled__true)
+{
+    key_filter instance{ 0 };
+    instance.add(to_key(1));
+    BOOST_REQUIRE(instance.contains(to_key(1)));
+    BOOST_REQUIRE(instance.contains(to_key(2)));
+}
+
+BOOST_AUTO_TEST_CASE(filter__contains__empty__false)
+{
+    const key_filter instance{ 1024 };
+    BOOST_REQUIRE(!instance.contains(to_key(1)));
+    BOOST_REQUIRE(!instance.contains(key{}));
+}
+
+BOOST_AUTO_TEST_CASE(filter__contains__added__true)
+{
+    key_filter instance{ 1024 };
+    for (uint32_t value = 0; value < 1000; ++value)
+        instance.add(to_key(value));
+
+    // No false negatives.
+    for (uint32_t value = 0; value < 1000; ++value)
+    {
+        BOOST_REQUIRE(instance.contains(to_key(value)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(filter__contains__not_added__mostly_false)
+{
+    // 16 bits per key.
+    key_filter instance{ 2'000 };
+    for (uint32_t value = 0; value < 1'000; ++value)
+        instance.add(to_key(value));
+
+    size_t positives{};
+    for (uint32_t value = 1'000; value < 101'000; ++value)
+        positives += instance.contains(to_key(value)) ? 1u : 0u;
+
+    // Expected false positive rate is under 1%, allow 2%.
+    BOOST_REQUIRE_LT(positives, 2'000u);
+}
+
+BOOST_AUTO_TEST_CASE(filter__clear__added__false)
+{
+    key_filter instance{ 1024 };
+    instance.add(to_key(42));
+    BOOST_REQUIRE(instance.contains(to_key(42)));
+    instance.clear();
+    BOOST_REQUIRE(!instance.contains(to_key(42)));
+}
+
+BOOST_AUTO_TEST_CASE(filter__reset__not_ready__true)
+{
+    key_filter instance{ 1024 };
+    instance.add(to_key(42));
+    instance.reset();
+    BOOST_REQUIRE(!instance.is_ready());
+    BOOST_REQUIRE(instance.contains(to_key(42)));
+    BOOST_REQUIRE(instance.contains(to_key(24)));
+
+    instance.add(to_key(24));
+    instance.set_ready();
+    BOOST_REQUIRE(instance.is_ready());
+    BOOST_REQUIRE(!instance.contains(to_key(42)));
+    BOOST_REQUIRE(instance.contains(to_key(24)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
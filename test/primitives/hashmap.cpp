@@ -23,11 +23,11 @@ BOOST_AUTO_TEST_SUITE(hashmap_tests)
 
 template <typename Link, typename Key, size_t Size>
 class hashmap_
-  : public hashmap<Link, Key, Size, true>
+  : public hashmap<Link, Key, Size, djb2_hasher>
 {
 public:
-    using base = hashmap<Link, Key, Size, true>;
-    using hashmap<Link, Key, Size, true>::hashmap;
+    using base = hashmap<Link, Key, Size, djb2_hasher>;
+    using hashmap<Link, Key, Size, djb2_hasher>::hashmap;
     ////using reader_ptr = std::shared_ptr<reader>;
     ////using finalizer_ptr = std::shared_ptr<finalizer>;
     ////
@@ -466,7 +466,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_get__terminal__invalid)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    const hashmap<link5, key10, little_record::size, true> instance{ head_store, body_store, buckets };
+    const hashmap<link5, key10, little_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
 
     little_record record{};
     BOOST_REQUIRE(!instance.get(link5::terminal, record));
@@ -477,7 +477,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_get__empty__invalid)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    const hashmap<link5, key10, little_record::size, true> instance{ head_store, body_store, buckets };
+    const hashmap<link5, key10, little_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
 
     little_record record{};
     BOOST_REQUIRE(!instance.get(0, record));
@@ -495,7 +495,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_get__populated__valid)
     };
     test::chunk_storage head_store{ head_file };
     test::chunk_storage body_store{ body_file };
-    const hashmap<link5, key10, little_record::size, true> instance{ head_store, body_store, buckets };
+    const hashmap<link5, key10, little_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
 
     little_record record{};
     BOOST_REQUIRE(instance.get(0, record));
@@ -507,7 +507,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_put__multiple__expected)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_record::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key1_big{ 0x41 };
@@ -598,7 +598,7 @@ BOOST_AUTO_TEST_CASE(hashmap__slab_put__multiple__expected)
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
 
-    hashmap<link5, key1, big_slab::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_slab::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key_big{ 0x41 };
@@ -662,7 +662,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_get__excess__false)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_record::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key{ 0x41 };
@@ -677,7 +677,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_get_key__excess__expected)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_record::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key{ 0x41 };
@@ -690,7 +690,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_put__excess__false)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_record::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key{ 0x41 };
@@ -747,7 +747,7 @@ BOOST_AUTO_TEST_CASE(hashmap__slab_get__excess__true)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_slab::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_slab::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key{ 0x41 };
@@ -764,7 +764,7 @@ BOOST_AUTO_TEST_CASE(hashmap__slab_get_key__excess__expected)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_slab::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_slab::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key{ 0x41 };
@@ -779,7 +779,7 @@ BOOST_AUTO_TEST_CASE(hashmap__slab_get__file_excess__false)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_slab::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_slab::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key{ 0x41 };
@@ -795,7 +795,7 @@ BOOST_AUTO_TEST_CASE(hashmap__slab_put__excess__false)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_slab::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_slab::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key{ 0x41 };
@@ -806,7 +806,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_top__default__terminal)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_record::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
     BOOST_REQUIRE(instance.top(0).is_terminal());
     BOOST_REQUIRE(instance.top(19).is_terminal());
@@ -817,7 +817,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_top__past_end__terminal)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_record::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
     BOOST_REQUIRE(instance.top(20).is_terminal());
     BOOST_REQUIRE(instance.top(21).is_terminal());
@@ -827,7 +827,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_top__existing__expected)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_record::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     BOOST_REQUIRE(!instance.put_link({ 0x41 }, big_record{ 0xa1b2c3d4_u32 }).is_terminal());
@@ -860,7 +860,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_exists__exists__true)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_record::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key{ 0x41 };
@@ -874,7 +874,7 @@ BOOST_AUTO_TEST_CASE(hashmap__slab_exists__exists__true)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_slab::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_slab::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key{ 0x41 };
@@ -888,7 +888,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_first__exists__true)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_record::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key{ 0x41 };
@@ -903,7 +903,7 @@ BOOST_AUTO_TEST_CASE(hashmap__slab_first__exists__true)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_slab::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_slab::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key{ 0x41 };
@@ -918,7 +918,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_it__exists__non_terminal)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_record::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key{ 0x41 };
@@ -935,7 +935,7 @@ BOOST_AUTO_TEST_CASE(hashmap__record_it__multiple__iterated)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key1, big_record::size, true> instance{ head_store, body_store, buckets };
+    hashmap<link5, key1, big_record::size, djb2_hasher> instance{ head_store, body_store, buckets };
     BOOST_REQUIRE(instance.create());
 
     constexpr key1 key_a{ 0xaa };
@@ -1142,7 +1142,7 @@ BOOST_AUTO_TEST_CASE(hashmap__set_commit__record__expected)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key10, flex_record::size, true> instance{ head_store, body_store, 2 };
+    hashmap<link5, key10, flex_record::size, djb2_hasher> instance{ head_store, body_store, 2 };
     BOOST_REQUIRE(instance.create());
 
     constexpr auto size = link5::size + array_count<key10> + flex_record::size;
@@ -1165,7 +1165,7 @@ BOOST_AUTO_TEST_CASE(hashmap__allocate_set_commit__record__expected)
     data_chunk head_file;
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key10, flex_record::size, true> instance{ head_store, body_store, 2 };
+    hashmap<link5, key10, flex_record::size, djb2_hasher> instance{ head_store, body_store, 2 };
     BOOST_REQUIRE(instance.create());
 
     constexpr auto size = link5::size + array_count<key10> + flex_record::size;
@@ -1188,7 +1188,7 @@ BOOST_AUTO_TEST_CASE(hashmap__allocate_put1__record__expected)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key10, flex_record::size, true> instance{ head_store, body_store, 2 };
+    hashmap<link5, key10, flex_record::size, djb2_hasher> instance{ head_store, body_store, 2 };
     BOOST_REQUIRE(instance.create());
     
     constexpr auto size = link5::size + array_count<key10> + sizeof(uint32_t);
@@ -1207,7 +1207,7 @@ BOOST_AUTO_TEST_CASE(hashmap__allocate_put2__record__expected)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key10, flex_record::size, true> instance{ head_store, body_store, 2 };
+    hashmap<link5, key10, flex_record::size, djb2_hasher> instance{ head_store, body_store, 2 };
     BOOST_REQUIRE(instance.create());
 
     constexpr key10 key1{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a };
@@ -1221,7 +1221,7 @@ BOOST_AUTO_TEST_CASE(hashmap__set_commit_link__slab__expected)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key10, flex_slab::size, true> instance{ head_store, body_store, 2 };
+    hashmap<link5, key10, flex_slab::size, djb2_hasher> instance{ head_store, body_store, 2 };
     BOOST_REQUIRE(instance.create());
 
     constexpr auto size = link5::size + array_count<key10> + sizeof(uint32_t);
@@ -1244,7 +1244,7 @@ BOOST_AUTO_TEST_CASE(hashmap__allocate_set_commit__slab__expected)
 {
     test::chunk_storage head_store{};
     test::chunk_storage body_store{};
-    hashmap<link5, key10, flex_slab::size, true> instance{ head_store, body_store, 2 };
+    hashmap<link5, key10, flex_slab::size, djb2_hasher> instance{ head_store, body_store, 2 };
     BOOST_REQUIRE(instance.create());
 
     constexpr auto size = link5::size + array_count<key10> + sizeof(uint32_t);
@@ -1269,7 +1269,7 @@ BOOST_AUTO_TEST_CASE(hashmap__allocate_put1__slab__expected)
     data_chunk body_file;
     test::chunk_storage head_store{ head_file };
     test::chunk_storage body_store{ body_file };
-    hashmap<link5, key10, flex_slab::size, true> instance{ head_store, body_store, 2 };
+    hashmap<link5, key10, flex_slab::size, djb2_hasher> instance{ head_store, body_store, 2 };
     BOOST_REQUIRE(instance.create());
 
     constexpr auto size = link5::size + array_count<key10> + sizeof(uint32_t);
@@ -1290,7 +1290,7 @@ BOOST_AUTO_TEST_CASE(hashmap__allocate_put2__slab__expected)
     data_chunk body_file;
     test::chunk_storage head_store{ head_file };
     test::chunk_storage body_store{ body_file };
-    hashmap<link5, key10, flex_slab::size, true> instance{ head_store, body_store, 2 };
+    hashmap<link5, key10, flex_slab::size, djb2_hasher> instance{ head_store, body_store, 2 };
     BOOST_REQUIRE(instance.create());
 
     constexpr key10 key1{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a };
@@ -1531,7 +1531,678 @@ BOOST_AUTO_TEST_CASE(hashmap__slab_body_count__non_empty_restore__truncates)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+// split
+// ----------------------------------------------------------------------------
+
+using resizable_table = hashmap<link5, key10, little_record::size, djb2_hasher>;
+
+static key10 split_key(uint8_t value) NOEXCEPT
+{
+    return { value, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a };
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__split__not_resizable__false)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 4 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(split_key(1), little_record{ 1 }));
+    BOOST_REQUIRE(!instance.split());
+    BOOST_REQUIRE_EQUAL(instance.buckets(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__split__empty__terminal_buckets)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 2, 1 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.split());
+    BOOST_REQUIRE_EQUAL(instance.buckets(), 3u);
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), base16_chunk("0000000000ffffffffffffffffffffffffffffff"));
+    BOOST_REQUIRE(instance.verify());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__put__load_exceeded__split_all_found)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 3, 2 };
+    BOOST_REQUIRE(instance.create());
+
+    for (uint8_t value = 0; value < 100; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(value), little_record{ value }));
+    }
+
+    // Each commit beyond the load splits one bucket.
+    BOOST_REQUIRE_EQUAL(instance.buckets(), 50u);
+    BOOST_REQUIRE_EQUAL(head_store.buffer().size(), (50u + 1u) * link5::size);
+
+    for (uint8_t value = 0; value < 100; ++value)
+    {
+        little_record record{};
+        BOOST_REQUIRE_EQUAL(instance.first(split_key(value)), value);
+        BOOST_REQUIRE(instance.get(instance.first(split_key(value)), record));
+        BOOST_REQUIRE_EQUAL(record.value, value);
+    }
+
+    BOOST_REQUIRE(!instance.exists(split_key(100)));
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__split__duplicate_keys__all_iterated)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 1, 1 };
+    BOOST_REQUIRE(instance.create());
+
+    for (uint8_t value = 0; value < 16; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(value % 4), little_record{ value }));
+    }
+
+    // Each key retains its four duplicates, newest first.
+    for (uint8_t value = 0; value < 4; ++value)
+    {
+        auto it = instance.it(split_key(value));
+        for (uint8_t duplicate = 4; duplicate > 0; --duplicate)
+        {
+            BOOST_REQUIRE_EQUAL(it.self(), value + (duplicate - 1) * 4);
+            BOOST_REQUIRE_EQUAL(it.advance(), duplicate > 1);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__split__iterator_pinned__false)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 2, 1 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(split_key(1), little_record{ 1 }));
+
+    {
+        const auto it = instance.it(split_key(1));
+        BOOST_REQUIRE(!instance.split());
+        BOOST_REQUIRE_EQUAL(instance.buckets(), 2u);
+    }
+
+    BOOST_REQUIRE(instance.split());
+    BOOST_REQUIRE_EQUAL(instance.buckets(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__put__split_deferred__backoff_then_split)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 2, 1 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(split_key(0), little_record{ 0 }));
+    BOOST_REQUIRE(instance.put(split_key(1), little_record{ 1 }));
+
+    // Allocated in advance, as the body cannot be remapped while pinned.
+    const auto link = instance.allocate(1);
+    BOOST_REQUIRE(instance.set(link, little_record{ 2 }));
+
+    // The split due on this commit is deferred by the pinned iterator.
+    {
+        const auto it = instance.it(split_key(0));
+        BOOST_REQUIRE(instance.commit(link, split_key(2)));
+        BOOST_REQUIRE_EQUAL(instance.buckets(), 2u);
+    }
+
+    // Further commits do not retry the split until backoff expires.
+    for (uint8_t value = 3; value < 3u + 64u; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(value), little_record{ value }));
+        BOOST_REQUIRE_EQUAL(instance.buckets(), 2u);
+    }
+
+    // All splits that are due are then drained by the next commit.
+    BOOST_REQUIRE(instance.put(split_key(67), little_record{ 67 }));
+    BOOST_REQUIRE_EQUAL(instance.buckets(), 68u);
+
+    for (uint8_t value = 0; value < 68; ++value)
+    {
+        BOOST_REQUIRE_EQUAL(instance.first(split_key(value)), value);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__verify__split_head__resizable_only)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 3, 1 };
+    BOOST_REQUIRE(instance.create());
+
+    for (uint8_t value = 0; value < 10; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(value), little_record{ value }));
+    }
+
+    BOOST_REQUIRE(instance.close());
+    BOOST_REQUIRE_EQUAL(instance.buckets(), 10u);
+
+    // The split bucket count is implied by the head size.
+    resizable_table reopened{ head_store, body_store, 3, 1 };
+    BOOST_REQUIRE(reopened.verify());
+    BOOST_REQUIRE_EQUAL(reopened.buckets(), 10u);
+
+    for (uint8_t value = 0; value < 10; ++value)
+    {
+        BOOST_REQUIRE_EQUAL(reopened.first(split_key(value)), value);
+    }
+
+    resizable_table fixed{ head_store, body_store, 3 };
+    BOOST_REQUIRE(!fixed.verify());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__put__concurrent_readers__splits_to_load)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 2, 2 };
+    BOOST_REQUIRE(instance.create());
+
+    // Readers continuously search committed keys while the writer splits.
+    constexpr size_t count = 200;
+    constexpr size_t readers = 3;
+    std::atomic<size_t> written{};
+    std::atomic<size_t> errors{};
+    std::vector<std::thread> threads{};
+    for (size_t thread = 0; thread < readers; ++thread)
+    {
+        threads.emplace_back([&]() NOEXCEPT
+        {
+            while (written.load() < count)
+            {
+                const auto committed = written.load();
+                for (size_t value = 0; value < committed; ++value)
+                {
+                    const auto key = split_key(static_cast<uint8_t>(value));
+                    if (instance.first(key) != value)
+                        ++errors;
+                }
+            }
+        });
+    }
+
+    for (size_t value = 0; value < count; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(static_cast<uint8_t>(value)),
+            little_record{ static_cast<uint32_t>(value) }));
+        written.store(add1(value));
+    }
+
+    for (auto& thread: threads)
+        thread.join();
+
+    BOOST_REQUIRE_EQUAL(errors.load(), 0u);
+
+    // Any split deferred by a reader remains due once backoff expires.
+    BOOST_REQUIRE(instance.put(split_key(count), little_record{ static_cast<uint32_t>(count) }));
+    while (2u * instance.buckets() < add1(count))
+    {
+        BOOST_REQUIRE(instance.split());
+    }
+
+    BOOST_REQUIRE_GE(2u * instance.buckets(), add1(count));
+    BOOST_REQUIRE_LT(2u * sub1(instance.buckets()), add1(count));
+
+    for (size_t value = 0; value <= count; ++value)
+    {
+        BOOST_REQUIRE_EQUAL(instance.first(split_key(static_cast<uint8_t>(value))), value);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__split__slab__false)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap<link5, key10, flex_slab::size, djb2_hasher> instance{ head_store, body_store, 2, 1 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(!instance.split());
+}
+
+// rebuild
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(hashmap__rebuild__unclosed__false)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 4 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(split_key(1), little_record{ 1 }));
+
+    // Head body count is not set until close.
+    BOOST_REQUIRE(!instance.rebuild());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__rebuild__rebucketed__all_found)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 3 };
+    BOOST_REQUIRE(instance.create());
+
+    for (uint8_t value = 0; value < 40; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(value), little_record{ value }));
+    }
+
+    BOOST_REQUIRE(instance.close());
+
+    for (const auto count: { 1u, 7u, 64u })
+    {
+        resizable_table rebuilt{ head_store, body_store, count };
+        BOOST_REQUIRE(rebuilt.rebuild());
+        BOOST_REQUIRE(rebuilt.verify());
+        BOOST_REQUIRE_EQUAL(rebuilt.buckets(), count);
+        BOOST_REQUIRE_EQUAL(head_store.buffer().size(), (count + 1u) * link5::size);
+
+        for (uint8_t value = 0; value < 40; ++value)
+        {
+            BOOST_REQUIRE_EQUAL(rebuilt.first(split_key(value)), value);
+        }
+
+        BOOST_REQUIRE(!rebuilt.exists(split_key(40)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__rebuild__duplicate_keys__order_preserved)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 2 };
+    BOOST_REQUIRE(instance.create());
+
+    for (uint8_t value = 0; value < 12; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(value % 3), little_record{ value }));
+    }
+
+    BOOST_REQUIRE(instance.close());
+    resizable_table rebuilt{ head_store, body_store, 5 };
+    BOOST_REQUIRE(rebuilt.rebuild());
+
+    // Each key retains its four duplicates, newest first.
+    for (uint8_t value = 0; value < 3; ++value)
+    {
+        auto it = rebuilt.it(split_key(value));
+        for (uint8_t duplicate = 4; duplicate > 0; --duplicate)
+        {
+            BOOST_REQUIRE_EQUAL(it.self(), value + (duplicate - 1) * 3);
+            BOOST_REQUIRE_EQUAL(it.advance(), duplicate > 1);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__rebuild__slab__all_found)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    using slab_map = hashmap<link5, key1, little_slab::size, djb2_hasher>;
+    slab_map instance{ head_store, body_store, 2 };
+    BOOST_REQUIRE(instance.create());
+
+    for (uint8_t value = 0; value < 10; ++value)
+    {
+        BOOST_REQUIRE(instance.put(key1{ value }, little_slab{ value }));
+    }
+
+    BOOST_REQUIRE(instance.close());
+    slab_map rebuilt{ head_store, body_store, 16 };
+    BOOST_REQUIRE(rebuilt.rebuild());
+    BOOST_REQUIRE(rebuilt.verify());
+
+    for (uint8_t value = 0; value < 10; ++value)
+    {
+        little_slab slab{};
+        BOOST_REQUIRE(rebuilt.get(rebuilt.first(key1{ value }), slab));
+        BOOST_REQUIRE_EQUAL(slab.value, value);
+    }
+}
+
+// filter
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(hashmap__first__filtered__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 4, 0, 1024 };
+    BOOST_REQUIRE(instance.create());
+
+    for (uint8_t value = 0; value < 20; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(value), little_record{ value }));
+    }
+
+    for (uint8_t value = 0; value < 20; ++value)
+    {
+        BOOST_REQUIRE_EQUAL(instance.first(split_key(value)), value);
+    }
+
+    BOOST_REQUIRE(!instance.exists(split_key(20)));
+    BOOST_REQUIRE(!instance.it(split_key(21)).advance());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__first__set_commit_filtered__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 4, 0, 1024 };
+    BOOST_REQUIRE(instance.create());
+
+    const auto link = instance.set_link(little_record{ 42 });
+    BOOST_REQUIRE(!instance.exists(split_key(42)));
+    BOOST_REQUIRE(instance.commit(link, split_key(42)));
+    BOOST_REQUIRE_EQUAL(instance.first(split_key(42)), link);
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__verify__filtered__populated)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 4 };
+    BOOST_REQUIRE(instance.create());
+
+    for (uint8_t value = 0; value < 20; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(value), little_record{ value }));
+    }
+
+    BOOST_REQUIRE(instance.close());
+
+    // Keys committed before open are added to the filter by verify, in the
+    // background, and are found whether or not the filter is yet ready.
+    resizable_table reopened{ head_store, body_store, 4, 0, 1024 };
+    BOOST_REQUIRE(reopened.verify());
+
+    for (uint8_t value = 0; value < 20; ++value)
+    {
+        BOOST_REQUIRE_EQUAL(reopened.first(split_key(value)), value);
+    }
+
+    while (!reopened.is_filtered())
+        std::this_thread::yield();
+
+    for (uint8_t value = 0; value < 20; ++value)
+    {
+        BOOST_REQUIRE_EQUAL(reopened.first(split_key(value)), value);
+    }
+
+    BOOST_REQUIRE(!reopened.exists(split_key(20)));
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__rebuild__filtered__repopulated)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 4 };
+    BOOST_REQUIRE(instance.create());
+
+    for (uint8_t value = 0; value < 20; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(value), little_record{ value }));
+    }
+
+    BOOST_REQUIRE(instance.close());
+
+    resizable_table reopened{ head_store, body_store, 4, 0, 1024 };
+    BOOST_REQUIRE(reopened.verify());
+    while (!reopened.is_filtered())
+        std::this_thread::yield();
+
+    // A populated filter is also reset and repopulated by rebuild.
+    BOOST_REQUIRE(reopened.rebuild());
+    for (uint8_t value = 0; value < 20; ++value)
+    {
+        BOOST_REQUIRE_EQUAL(reopened.first(split_key(value)), value);
+    }
+
+    while (!reopened.is_filtered())
+        std::this_thread::yield();
+
+    for (uint8_t value = 0; value < 20; ++value)
+    {
+        BOOST_REQUIRE_EQUAL(reopened.first(split_key(value)), value);
+    }
+
+    BOOST_REQUIRE(!reopened.exists(split_key(20)));
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__close__populating__stopped)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 4 };
+    BOOST_REQUIRE(instance.create());
+
+    for (size_t value = 0; value < 10000; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(static_cast<uint8_t>(value)),
+            little_record{ static_cast<uint32_t>(value) }));
+    }
+
+    BOOST_REQUIRE(instance.close());
+
+    // Close stops (joins) population, populated or not.
+    resizable_table reopened{ head_store, body_store, 4, 0, 1024 };
+    BOOST_REQUIRE(reopened.verify());
+    BOOST_REQUIRE(reopened.close());
+    BOOST_REQUIRE(reopened.verify());
+    BOOST_REQUIRE(reopened.exists(split_key(42)));
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__restore__filtered_slab__populated)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    using slab_map = hashmap<link5, key1, little_slab::size, djb2_hasher>;
+    slab_map instance{ head_store, body_store, 4 };
+    BOOST_REQUIRE(instance.create());
+
+    for (uint8_t value = 0; value < 10; ++value)
+    {
+        BOOST_REQUIRE(instance.put(key1{ value }, little_slab{ value }));
+    }
+
+    BOOST_REQUIRE(instance.backup());
+
+    slab_map restored{ head_store, body_store, 4, 0, 1024 };
+    BOOST_REQUIRE(restored.restore());
+
+    for (uint8_t value = 0; value < 10; ++value)
+    {
+        little_slab slab{};
+        BOOST_REQUIRE(restored.get(restored.first(key1{ value }), slab));
+        BOOST_REQUIRE_EQUAL(slab.value, value);
+    }
+
+    BOOST_REQUIRE(!restored.exists(key1{ 10 }));
+
+    while (!restored.is_filtered())
+        std::this_thread::yield();
+
+    BOOST_REQUIRE(!restored.exists(key1{ 10 }));
+    BOOST_REQUIRE(restored.exists(key1{ 9 }));
+}
+
+// fingerprints
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(hashmap__first__fingerprints_split__all_found)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 2, 2, 0, true };
+    BOOST_REQUIRE(instance.create());
+
+    for (uint8_t value = 0; value < 60; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(value), little_record{ value }));
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.buckets(), 30u);
+    BOOST_REQUIRE_EQUAL(head_store.buffer().size(), link5::size + 30u * (link5::size + 2u));
+
+    for (uint8_t value = 0; value < 60; ++value)
+    {
+        BOOST_REQUIRE_EQUAL(instance.first(split_key(value)), value);
+    }
+
+    BOOST_REQUIRE(!instance.exists(split_key(60)));
+    BOOST_REQUIRE(instance.close());
+
+    resizable_table reopened{ head_store, body_store, 2, 2, 0, true };
+    BOOST_REQUIRE(reopened.verify());
+    BOOST_REQUIRE_EQUAL(reopened.buckets(), 30u);
+
+    resizable_table rebuilt{ head_store, body_store, 7, 0, 0, true };
+    BOOST_REQUIRE(rebuilt.rebuild());
+    BOOST_REQUIRE(rebuilt.verify());
+
+    for (uint8_t value = 0; value < 60; ++value)
+    {
+        BOOST_REQUIRE_EQUAL(rebuilt.first(split_key(value)), value);
+    }
+}
+
 ////std::cout << head_file << std::endl << std::endl;
 ////std::cout << body_file << std::endl << std::endl;
 
+// batch
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(hashmap__first_batch__size_mismatch__false)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 4 };
+    BOOST_REQUIRE(instance.create());
+
+    const std_vector<key10> keys{ split_key(0), split_key(1) };
+    std_vector<link5> links(1);
+    BOOST_REQUIRE(!instance.first(keys, links));
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__first_batch__mixed__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 5, 0, 1024, true };
+    BOOST_REQUIRE(instance.create());
+
+    // Only even keys are stored, and keys span multiple lookup groups.
+    for (uint8_t value = 0; value < 100; value += 2)
+    {
+        BOOST_REQUIRE(instance.put(split_key(value), little_record{ value }));
+    }
+
+    std_vector<key10> keys{};
+    for (uint8_t value = 0; value < 100; ++value)
+        keys.push_back(split_key(value));
+
+    std_vector<link5> links(keys.size());
+    BOOST_REQUIRE(instance.first(keys, links));
+
+    for (uint8_t value = 0; value < 100; ++value)
+    {
+        BOOST_REQUIRE_EQUAL(links[value], instance.first(split_key(value)));
+        BOOST_REQUIRE_EQUAL(links[value].is_terminal(), !is_zero(value % 2));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__first_batch__duplicate_keys__first_expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    using slab_map = hashmap<link5, key1, little_slab::size, djb2_hasher>;
+    slab_map instance{ head_store, body_store, 2 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(key1{ 1 }, little_slab{ 1 }));
+    BOOST_REQUIRE(instance.put(key1{ 1 }, little_slab{ 2 }));
+
+    const std_vector<key1> keys{ key1{ 1 }, key1{ 2 }, key1{ 1 } };
+    std_vector<link5> links(keys.size());
+    BOOST_REQUIRE(instance.first(keys, links));
+    BOOST_REQUIRE_EQUAL(links[0], instance.first(key1{ 1 }));
+    BOOST_REQUIRE(links[1].is_terminal());
+    BOOST_REQUIRE_EQUAL(links[2], links[0]);
+
+    little_slab slab{};
+    BOOST_REQUIRE(instance.get(links[0], slab));
+    BOOST_REQUIRE_EQUAL(slab.value, 2u);
+}
+
+// cursor
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(hashmap__find__duplicate_keys__all_iterated)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 2, 2 };
+    BOOST_REQUIRE(instance.create());
+
+    for (uint8_t value = 0; value < 20; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(value % 4), little_record{ value }));
+    }
+
+    // Both walks observe the same elements in the same order.
+    const auto key = split_key(1);
+    auto cursor = instance.find(key);
+    auto it = instance.it(key);
+    size_t count{};
+    do
+    {
+        BOOST_REQUIRE_EQUAL(cursor.self(), it.self());
+        ++count;
+        BOOST_REQUIRE_EQUAL(cursor.advance(), it.advance());
+    }
+    while (!it.self().is_terminal());
+
+    BOOST_REQUIRE_EQUAL(count, 5u);
+    BOOST_REQUIRE(cursor.self().is_terminal());
+    BOOST_REQUIRE(instance.find(split_key(4)).self().is_terminal());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__find__split_between_advances__all_iterated)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    resizable_table instance{ head_store, body_store, 2, 8 };
+    BOOST_REQUIRE(instance.create());
+
+    for (uint8_t value = 0; value < 16; ++value)
+    {
+        BOOST_REQUIRE(instance.put(split_key(value % 4), little_record{ value }));
+    }
+
+    // The cursor does not pin resizing between advances.
+    const auto key = split_key(1);
+    auto cursor = instance.find(key);
+    BOOST_REQUIRE_EQUAL(cursor.self(), 13u);
+    BOOST_REQUIRE(instance.split());
+    BOOST_REQUIRE(instance.split());
+    BOOST_REQUIRE_EQUAL(instance.buckets(), 4u);
+
+    // The remaining duplicates are found in order, across the relinked list.
+    BOOST_REQUIRE(cursor.advance());
+    BOOST_REQUIRE_EQUAL(cursor.self(), 9u);
+    BOOST_REQUIRE(instance.split());
+    BOOST_REQUIRE(cursor.advance());
+    BOOST_REQUIRE_EQUAL(cursor.self(), 5u);
+    BOOST_REQUIRE(cursor.advance());
+    BOOST_REQUIRE_EQUAL(cursor.self(), 1u);
+    BOOST_REQUIRE(!cursor.advance());
+    BOOST_REQUIRE(cursor.self().is_terminal());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -18,6 +18,7 @@
  */
 #include "../test.hpp"
 #include "../mocks/chunk_storage.hpp"
+#include <set>
 
 BOOST_AUTO_TEST_SUITE(head_tests)
 
@@ -37,20 +38,9 @@ static_assert(buckets == 20u);
 
 using link = linkage<link_size>;
 using key = data_array<key_size>;
-using djb2_header = head<link, key, true>;
-
-// Derived accessor to also expose unique_hash.
-class unique_header
-  : public head<link, key, false>
-{
-public:
-    using head<link, key, false>::head;
-
-    static constexpr size_t unique_hash(const key& value) NOEXCEPT
-    {
-        return head<link, key, false>::unique_hash(value);
-    }
-};
+using djb2_header = head<link, key, djb2_hasher>;
+using unique_header = head<link, key, unique_hasher>;
+using mix_header = head<link, key, mix_hasher>;
 
 class nullptr_storage
   : public test::chunk_storage
@@ -118,10 +108,62 @@ BOOST_AUTO_TEST_CASE(head__set_body_count__get__expected)
     BOOST_REQUIRE_EQUAL(count, expected);
 }
 
+BOOST_AUTO_TEST_CASE(head__rebucket__uncreated__false)
+{
+    data_chunk data;
+    test::chunk_storage store{ data };
+    djb2_header head{ store, buckets };
+
+    std::vector<link> tops{};
+    BOOST_REQUIRE(!head.rebucket(tops, zero));
+}
+
+BOOST_AUTO_TEST_CASE(head__rebucket__body_count_mismatch__false_unchanged)
+{
+    data_chunk data;
+    test::chunk_storage store{ data };
+    djb2_header head{ store, buckets };
+    BOOST_REQUIRE(head.create());
+    BOOST_REQUIRE(head.set_body_count(42u));
+
+    std::vector<link> tops{};
+    BOOST_REQUIRE(!head.rebucket(tops, 24u));
+    BOOST_REQUIRE_EQUAL(data.size(), head_size);
+}
+
+BOOST_AUTO_TEST_CASE(head__rebucket__prior_buckets__expected_tops)
+{
+    data_chunk data;
+    test::chunk_storage store{ data };
+    djb2_header prior{ store, buckets };
+    BOOST_REQUIRE(prior.create());
+    BOOST_REQUIRE(prior.set_body_count(42u));
+
+    typename link::bytes next{};
+    BOOST_REQUIRE(prior.push(link{ 7u }, next, link{ 3u }));
+    BOOST_REQUIRE(prior.push(link{ 9u }, next, link{ 19u }));
+
+    // The configured bucket count need not match the head.
+    djb2_header head{ store, 4u };
+    std::vector<link> tops{};
+    BOOST_REQUIRE(head.rebucket(tops, 42u));
+    BOOST_REQUIRE_EQUAL(tops.size(), buckets);
+    BOOST_REQUIRE_EQUAL(tops.at(3), 7u);
+    BOOST_REQUIRE_EQUAL(tops.at(19), 9u);
+    BOOST_REQUIRE(tops.at(0).is_terminal());
+
+    link count{};
+    BOOST_REQUIRE(head.verify());
+    BOOST_REQUIRE(head.get_body_count(count));
+    BOOST_REQUIRE_EQUAL(count, 42u);
+    BOOST_REQUIRE_EQUAL(data.size(), (4u + 1u) * link_size);
+    BOOST_REQUIRE(head.top(link{ 3u }).is_terminal());
+}
+
 BOOST_AUTO_TEST_CASE(head__unique_hash__null_key__expected)
 {
     constexpr key null_key{};
-    const auto expected = unique_header::unique_hash(null_key) % buckets;
+    const auto expected = unique_hasher::hash(null_key) % buckets;
     BOOST_REQUIRE_EQUAL(expected, 0u);
 
     test::chunk_storage store;
@@ -148,6 +190,56 @@ BOOST_AUTO_TEST_CASE(head__djb2_hash__null_key__expected)
     BOOST_REQUIRE_EQUAL(head.index(null_key), expected);
 }
 
+BOOST_AUTO_TEST_CASE(head__mix_hash__null_key__expected)
+{
+    constexpr key null_key{};
+    const auto expected = mix_hasher::hash(null_key) % buckets;
+
+    if constexpr (build_x64)
+    {
+        BOOST_REQUIRE_EQUAL(expected, 12u);
+    }
+
+    test::chunk_storage store;
+    mix_header head{ store, buckets };
+    BOOST_REQUIRE_EQUAL(head.index(null_key), expected);
+}
+
+BOOST_AUTO_TEST_CASE(head__index__high_order_keys__mix_distributed)
+{
+    test::chunk_storage store;
+    mix_header mix{ store, buckets };
+    unique_header unique{ store, buckets };
+
+    // Keys that differ only beyond the low order eight bytes.
+    std::set<size_t> mixed{};
+    std::set<size_t> copied{};
+    for (uint8_t byte = 0; byte < buckets; ++byte)
+    {
+        key value{};
+        value.back() = byte;
+        mixed.insert(mix.index(value));
+        copied.insert(unique.index(value));
+    }
+
+    BOOST_REQUIRE_EQUAL(copied.size(), one);
+    BOOST_REQUIRE_GT(mixed.size(), to_half(buckets));
+}
+
+BOOST_AUTO_TEST_CASE(head__index__power2_buckets__modulo_equivalent)
+{
+    constexpr auto power2 = 16u;
+    test::chunk_storage store;
+    mix_header head{ store, power2 };
+
+    for (uint8_t byte = 0; byte < buckets; ++byte)
+    {
+        key value{};
+        value.front() = byte;
+        BOOST_REQUIRE_EQUAL(head.index(value), mix_hasher::hash(value) % power2);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(head__top__link__terminal)
 {
     test::chunk_storage store;
@@ -214,4 +306,130 @@ BOOST_AUTO_TEST_CASE(head__push__key__terminal)
     BOOST_REQUIRE_EQUAL(head.top(null_key), expected);
 }
 
+BOOST_AUTO_TEST_CASE(head__push__concurrent__all_chained)
+{
+    test::chunk_storage store;
+    djb2_header head{ store, buckets };
+    BOOST_REQUIRE(head.create());
+
+    constexpr auto threads = 8_size;
+    constexpr auto pushes = 1000_size;
+    constexpr auto count = threads * pushes;
+    std::vector<typename link::bytes> nexts(count);
+    std::vector<std::thread> workers{};
+
+    // Threads push interleaved links to one shared and one distinct bucket.
+    for (size_t thread = 0; thread < threads; ++thread)
+    {
+        workers.emplace_back([&, thread]()
+        {
+            for (size_t push = 0; push < pushes; ++push)
+            {
+                const auto value = thread + push * threads;
+                const link bucket{ is_even(value) ? 0u : add1(thread) };
+                head.push(link{ value }, nexts.at(value), bucket);
+            }
+        });
+    }
+
+    for (auto& worker: workers)
+        worker.join();
+
+    // Every link is reachable from exactly one of the buckets.
+    size_t found{};
+    for (size_t bucket = 0; bucket <= threads; ++bucket)
+        for (link next = head.top(bucket); !next.is_terminal();
+            next = nexts.at(next))
+            ++found;
+
+    BOOST_REQUIRE_EQUAL(found, count);
+}
+
+// fingerprints
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(head__create__fingerprints__expected)
+{
+    data_chunk data;
+    test::chunk_storage store{ data };
+    unique_header head{ store, 2, false, true };
+    BOOST_REQUIRE(head.create());
+    BOOST_REQUIRE(head.verify());
+    BOOST_REQUIRE_EQUAL(head.size(), link_size + 2u * (link_size + 2u));
+    BOOST_REQUIRE_EQUAL(data, base16_chunk("0000000000ffffffffff0000ffffffffff0000"));
+}
+
+BOOST_AUTO_TEST_CASE(head__verify__fingerprints_mismatch__false)
+{
+    test::chunk_storage store;
+    unique_header head{ store, buckets, false, true };
+    BOOST_REQUIRE(head.create());
+
+    unique_header plain{ store, buckets };
+    BOOST_REQUIRE(!plain.verify());
+}
+
+BOOST_AUTO_TEST_CASE(head__top__fingerprint_excluded__terminal)
+{
+    test::chunk_storage store;
+    unique_header head{ store, buckets, false, true };
+    BOOST_REQUIRE(head.create());
+
+    // Same bucket (zero), fingerprints from high byte 0x00 and 0x11.
+    constexpr key pushed{};
+    constexpr key absent{ 0x08, 0, 0, 0, 0, 0, 0, 0x11 };
+    BOOST_REQUIRE_EQUAL(head.index(pushed), head.index(absent));
+
+    typename link::bytes next{};
+    BOOST_REQUIRE(head.push(link{ 42u }, next, pushed));
+    BOOST_REQUIRE(link{ next }.is_terminal());
+    BOOST_REQUIRE_EQUAL(head.top(pushed), 42u);
+    BOOST_REQUIRE_EQUAL(head.top(link{ 0u }), 42u);
+    BOOST_REQUIRE(head.top(absent).is_terminal());
+}
+
+BOOST_AUTO_TEST_CASE(head__top__index_pushed_fingerprints__not_excluded)
+{
+    test::chunk_storage store;
+    unique_header head{ store, buckets, false, true };
+    BOOST_REQUIRE(head.create());
+
+    // Push without key sets all fingerprints of the bucket.
+    constexpr key absent{ 0x08, 0, 0, 0, 0, 0, 0, 0x11 };
+    typename link::bytes next{};
+    BOOST_REQUIRE(head.push(link{ 42u }, next, link{ 0u }));
+    BOOST_REQUIRE_EQUAL(head.top(absent), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(head__rebucket__fingerprints__expected_tops)
+{
+    data_chunk data;
+    test::chunk_storage store{ data };
+    unique_header prior{ store, buckets, false, true };
+    BOOST_REQUIRE(prior.create());
+
+    typename link::bytes next{};
+    BOOST_REQUIRE(prior.push(link{ 7u }, next, link{ 3u }));
+
+    unique_header head{ store, 4u, false, true };
+    std::vector<link> tops{};
+    BOOST_REQUIRE(head.rebucket(tops, zero));
+    BOOST_REQUIRE_EQUAL(tops.size(), buckets);
+    BOOST_REQUIRE_EQUAL(tops.at(3), 7u);
+    BOOST_REQUIRE_EQUAL(data.size(), link_size + 4u * (link_size + 2u));
+}
+
+BOOST_AUTO_TEST_CASE(head__to_buckets__fingerprints__expected)
+{
+    data_chunk data;
+    test::chunk_storage store{ data };
+    unique_header head{ store, 2u, false, true };
+    BOOST_REQUIRE(head.create());
+    BOOST_REQUIRE_EQUAL(unique_header::to_buckets(data.size(), true), 2u);
+    BOOST_REQUIRE_EQUAL(unique_header::to_buckets(data.size(), false), 0u);
+    BOOST_REQUIRE_EQUAL(unique_header::to_buckets(sub1(link_size), true), 0u);
+    BOOST_REQUIRE_EQUAL(unique_header::slot_size(true), link_size + 2u);
+    BOOST_REQUIRE_EQUAL(unique_header::slot_size(false), link_size);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
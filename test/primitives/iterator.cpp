@@ -18,6 +18,7 @@
  */
 #include "../test.hpp"
 #include "../mocks/chunk_storage.hpp"
+#include <chrono>
 
 BOOST_AUTO_TEST_SUITE(iterator_tests)
 
@@ -181,4 +182,105 @@ BOOST_AUTO_TEST_CASE(iterator__next__true__non_terminal)
     BOOST_REQUIRE(iterator.self().is_terminal());
 }
 
+BOOST_AUTO_TEST_CASE(iterator__is_match__hash_key__expected)
+{
+    using link = linkage<4>;
+    using key = data_array<32>;
+    using record_iterate = iterator_<link, key, 0>;
+
+    key hash{};
+    for (size_t index = 0; index < hash.size(); ++index)
+        hash[index] = narrow_cast<uint8_t>(add1(index));
+
+    data_chunk data(link::size + hash.size(), 0xff);
+    std::copy(hash.begin(), hash.end(), std::next(data.begin(), link::size));
+    test::chunk_storage file{ data };
+    const record_iterate iterator{ file.get(), 0, hash };
+    BOOST_REQUIRE(iterator.is_match_());
+
+    // A difference at any byte position is a mismatch.
+    for (size_t index = 0; index < hash.size(); ++index)
+    {
+        auto other = hash;
+        other[index] ^= 0x80;
+        const record_iterate mismatch{ file.get(), 0, other };
+        BOOST_REQUIRE(!mismatch.is_match_());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(iterator__advance__hash_key_chain__expected)
+{
+    using link = linkage<1>;
+    using key = data_array<32>;
+    using record_iterate = iterator_<link, key, 0>;
+    constexpr auto element = link::size + array_count<key>;
+
+    // Chain 0->1->2->terminal, with elements 0 and 2 matching.
+    key hash{};
+    hash.fill(0x42);
+    data_chunk data(3u * element, 0x42);
+    data[0 * element] = 0x01;
+    data[1 * element] = 0x02;
+    data[1 * element + link::size] = 0x24;
+    data[2 * element] = 0xff;
+    test::chunk_storage file{ data };
+
+    record_iterate iterator{ file.get(), 0, hash };
+    BOOST_REQUIRE_EQUAL(iterator.self(), 0x00u);
+    BOOST_REQUIRE(iterator.advance());
+    BOOST_REQUIRE_EQUAL(iterator.self(), 0x02u);
+    BOOST_REQUIRE(!iterator.advance());
+    BOOST_REQUIRE(iterator.self().is_terminal());
+}
+
+// Micro-benchmark of lookup time against chain length, run explicitly with:
+// --run_test=iterator_tests/iterator__advance__chain_length__benchmark
+BOOST_AUTO_TEST_CASE(iterator__advance__chain_length__benchmark,
+    * boost::unit_test::disabled())
+{
+    using link = linkage<4>;
+    using key = data_array<32>;
+    using record_iterate = iterator_<link, key, 8>;
+    constexpr auto element = link::size + array_count<key> + 8u;
+    constexpr auto lookups = 100'000u;
+
+    for (size_t length = 1; length <= 64u; length *= 2u)
+    {
+        // Chain elements are strided to defeat adjacent line prefetch.
+        constexpr auto stride = 67u;
+        const auto count = length * stride;
+        data_chunk data(count * element, 0x00);
+        for (size_t index = 0; index < length; ++index)
+        {
+            const auto position = index * stride * element;
+            const auto next = add1(index) == length ? link::terminal :
+                narrow_cast<uint32_t>(add1(index) * stride);
+            const auto bytes = to_little_endian(next);
+            std::copy(bytes.begin(), bytes.end(), std::next(data.begin(),
+                position));
+            std::fill_n(std::next(data.begin(), position + link::size),
+                array_count<key>, narrow_cast<uint8_t>(index));
+        }
+
+        // Match only the last element of the chain.
+        key hash{};
+        hash.fill(narrow_cast<uint8_t>(sub1(length)));
+        test::chunk_storage file{ data };
+
+        size_t found{};
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t lookup = 0; lookup < lookups; ++lookup)
+            found += record_iterate{ file.get(), 0, hash }.self().is_terminal() ?
+                zero : one;
+
+        const auto span = std::chrono::steady_clock::now() - start;
+        const auto nanoseconds = std::chrono::duration_cast<
+            std::chrono::nanoseconds>(span).count() / lookups;
+
+        BOOST_REQUIRE_EQUAL(found, lookups);
+        BOOST_TEST_MESSAGE("chain length " << length << ": " << nanoseconds
+            << " ns/lookup");
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
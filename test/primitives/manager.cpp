@@ -131,6 +131,20 @@ BOOST_AUTO_TEST_CASE(manager__allocate__non_empty_slab__expected)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(manager__deallocate__last_slab__true_reduced)
+{
+    data_chunk buffer;
+    test::chunk_storage file(buffer);
+    manager<linkage<4>, key1, max_size_t> instance(file);
+    BOOST_REQUIRE_EQUAL(instance.allocate(10), zero);
+    BOOST_REQUIRE_EQUAL(instance.allocate(32), 10u);
+    BOOST_REQUIRE(!instance.deallocate(zero, 10));
+    BOOST_REQUIRE(!instance.deallocate(linkage<4>::terminal, 32));
+    BOOST_REQUIRE(instance.deallocate(10, 32));
+    BOOST_REQUIRE_EQUAL(instance.count(), 10u);
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 BOOST_AUTO_TEST_CASE(manager__get__terminal_slab__terminal)
 {
     constexpr auto size = 14u;
@@ -282,6 +296,20 @@ BOOST_AUTO_TEST_CASE(manager__allocate__non_empty_record__expected)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(manager__deallocate__last_record__true_reduced)
+{
+    data_chunk buffer;
+    test::chunk_storage file(buffer);
+    manager<linkage<2>, key0, 5u> instance(file);
+    BOOST_REQUIRE_EQUAL(instance.allocate(1), zero);
+    BOOST_REQUIRE_EQUAL(instance.allocate(3), 1u);
+    BOOST_REQUIRE(!instance.deallocate(1, 2));
+    BOOST_REQUIRE(instance.deallocate(1, 3));
+    BOOST_REQUIRE_EQUAL(instance.count(), 1u);
+    BOOST_REQUIRE_EQUAL(buffer.size(), 5u);
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 BOOST_AUTO_TEST_CASE(manager__get__terminal_record__terminal)
 {
     data_chunk buffer(14, 0xff);
@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../mocks/chunk_storage.hpp"
+#include <chrono>
+
+BOOST_AUTO_TEST_SUITE(view_tests)
+
+using namespace system;
+
+BOOST_AUTO_TEST_CASE(view__get__little_endian__expected)
+{
+    data_chunk data{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    const view<8> source{ data.data() };
+    BOOST_REQUIRE_EQUAL((source.get<0, uint8_t>()), 0x01u);
+    BOOST_REQUIRE_EQUAL((source.get<1, uint16_t>()), 0x0302u);
+    BOOST_REQUIRE_EQUAL((source.get<1, uint32_t, 3>()), 0x040302u);
+    BOOST_REQUIRE_EQUAL((source.get<4, uint32_t>()), 0x08070605u);
+    BOOST_REQUIRE_EQUAL((source.get<0, uint64_t>()), 0x0807060504030201u);
+    BOOST_REQUIRE_EQUAL((source.get<3, uint64_t, 5>()), 0x0807060504u);
+}
+
+BOOST_AUTO_TEST_CASE(view__set__little_endian__expected)
+{
+    data_chunk data(8, 0x00);
+    const view<8> sink{ data.data() };
+    sink.set<0, uint8_t>(0x01);
+    sink.set<1, uint32_t, 3>(0xaa040302);
+    sink.set<4, uint32_t>(0x08070605);
+    BOOST_REQUIRE_EQUAL(data, base16_chunk("0102030405060708"));
+}
+
+BOOST_AUTO_TEST_CASE(view__bytes__offset__expected)
+{
+    data_chunk data{ 0x01, 0x02, 0x03, 0x04 };
+    const view<4> source{ data.data() };
+    auto& bytes = source.bytes<1, 2>();
+    BOOST_REQUIRE_EQUAL(bytes, (data_array<2>{ 0x02, 0x03 }));
+    bytes[0] = 0x42;
+    BOOST_REQUIRE_EQUAL(data[1], 0x42);
+}
+
+class viewed
+{
+public:
+    static constexpr size_t size = 4;
+    static constexpr linkage<4> count() NOEXCEPT { return 1; }
+
+    inline bool from_view(const view<size>& source) NOEXCEPT
+    {
+        value = source.get<zero, uint32_t>();
+        return true;
+    }
+
+    inline void to_view(const view<size>& sink) const NOEXCEPT
+    {
+        sink.set<zero, uint32_t>(value);
+    }
+
+    uint32_t value{};
+};
+
+class streamed
+{
+public:
+    static constexpr size_t size = 4;
+    static constexpr linkage<4> count() NOEXCEPT { return 1; }
+
+    inline bool from_data(database::reader& source) NOEXCEPT
+    {
+        value = source.read_little_endian<uint32_t>();
+        return source;
+    }
+
+    inline bool to_data(database::finalizer& sink) const NOEXCEPT
+    {
+        sink.write_little_endian<uint32_t>(value);
+        return sink;
+    }
+
+    uint32_t value{};
+};
+
+static_assert(is_view_readable<viewed, viewed::size>);
+static_assert(is_view_writable<viewed, viewed::size>);
+static_assert(!is_view_readable<streamed, streamed::size>);
+static_assert(!is_view_writable<streamed, streamed::size>);
+
+using key4 = data_array<4>;
+using view_map = hashmap<linkage<4>, key4, viewed::size, djb2_hasher>;
+
+BOOST_AUTO_TEST_CASE(view__hashmap_put_get__viewed__same_as_streamed)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    view_map instance{ head_store, body_store, 4 };
+    BOOST_REQUIRE(instance.create());
+
+    constexpr key4 key{ 0x01, 0x02, 0x03, 0x04 };
+    const auto link = instance.put_link(key, viewed{ 0xa1b2c3d4 });
+    BOOST_REQUIRE(!link.is_terminal());
+    BOOST_REQUIRE(instance.put(key, streamed{ 0xa1b2c3d4 }));
+
+    // Both elements serialize identically (other than next link).
+    const auto& body = body_store.buffer();
+    BOOST_REQUIRE(std::equal(std::next(body.begin(), 4), std::next(body.begin(), 12),
+        std::next(body.begin(), 16)));
+
+    viewed element{};
+    BOOST_REQUIRE(instance.get(link, element));
+    BOOST_REQUIRE_EQUAL(element.value, 0xa1b2c3d4u);
+    BOOST_REQUIRE(instance.set(link, viewed{ 42 }));
+    BOOST_REQUIRE(instance.get(link, element));
+    BOOST_REQUIRE_EQUAL(element.value, 42u);
+
+    // Bound is checked once for the element.
+    BOOST_REQUIRE(!instance.get(2, element));
+}
+
+BOOST_AUTO_TEST_CASE(view__arraymap_put_get__viewed__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    arraymap<linkage<4>, viewed::size> instance{ head_store, body_store };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(viewed{ 0xa1b2c3d4 }));
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), base16_chunk("d4c3b2a1"));
+
+    viewed element{};
+    BOOST_REQUIRE(instance.get(0, element));
+    BOOST_REQUIRE_EQUAL(element.value, 0xa1b2c3d4u);
+    BOOST_REQUIRE(!instance.get(1, element));
+}
+
+// Micro-benchmark of stream against view element reads, run explicitly with:
+// --run_test=view_tests/view__hashmap_get__streamed_viewed__benchmark
+BOOST_AUTO_TEST_CASE(view__hashmap_get__streamed_viewed__benchmark,
+    * boost::unit_test::disabled())
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    view_map instance{ head_store, body_store, 1024 };
+    BOOST_REQUIRE(instance.create());
+
+    constexpr auto records = 1'000u;
+    constexpr auto reads = 1'000'000u;
+    for (uint32_t value = 0; value < records; ++value)
+    {
+        const auto key = to_little_endian(value);
+        BOOST_REQUIRE(instance.put(key, viewed{ value }));
+    }
+
+    const auto time = [&](auto element) NOEXCEPT
+    {
+        uint64_t sum{};
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t read = 0; read < reads; ++read)
+        {
+            instance.get(read % records, element);
+            sum += element.value;
+        }
+
+        const auto span = std::chrono::steady_clock::now() - start;
+        BOOST_REQUIRE_EQUAL(sum, (reads / records) * (records * (records - 1u) / 2u));
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(span).count() / reads;
+    };
+
+    BOOST_TEST_MESSAGE("streamed: " << time(streamed{}) << " ns/get");
+    BOOST_TEST_MESSAGE("viewed: " << time(viewed{}) << " ns/get");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -132,7 +132,9 @@ BOOST_AUTO_TEST_CASE(query_archive__set_link_header__is_header__expected)
         "44434241" // timestamp
         "54535251" // bits
         "64636261" // nonce
-        "119192939495969798999a9b9c9d9e9f229192939495969798999a9b9c9d9e9f"); //merkle_root
+        "119192939495969798999a9b9c9d9e9f229192939495969798999a9b9c9d9e9f" //merkle_root
+        "0000000000000000000000000000000000000000000000000000000000000000" // work (bits overflowed)
+        "ffffff"); // skip_fk (terminal)
 
     settings settings{};
     settings.header_buckets = 10;
@@ -260,9 +262,9 @@ BOOST_AUTO_TEST_CASE(query_archive__set_link_tx__null_input__expected)
     const auto expected_point_body = system::base16_chunk("");
     const auto expected_spend_head = system::base16_chunk(
         "01000000"     // record count
-        "00000000"     // pk->
         "ffffffff"
         "ffffffff"
+        "00000000"     // pk->
         "ffffffff"
         "ffffffff");
     const auto expected_spend_body = system::base16_chunk(
@@ -390,11 +392,11 @@ BOOST_AUTO_TEST_CASE(query_archive__set_tx__get_tx__expected)
         "0100000000000000000000000000000000000000000000000000000000000000"); // sk (prevout.hash)
     const auto expected_spend_head = system::base16_chunk(
         "02000000"     // record count
-        "ffffffff"
-        "ffffffff"
         "01000000"     // spend1_fk->
         "ffffffff"
-        "00000000");   // spend0_fk->
+        "00000000"     // spend0_fk->
+        "ffffffff"
+        "ffffffff");
     const auto expected_spend_body = system::base16_chunk(
         "ffffffff"     // terminal->
         "00000000"     // fp: point_fk->
@@ -472,7 +474,9 @@ BOOST_AUTO_TEST_CASE(query_archive__set_block__get_block__expected)
         "29ab5f49"     // timestamp
         "ffff001d"     // bits
         "1dac2b7c"     // nonce
-        "3ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a"); // merkle_root
+        "3ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a" // merkle_root
+        "0100010001000000000000000000000000000000000000000000000000000000" // work
+        "ffffff"); // skip_fk (terminal)
     const auto genesis_tx_head = system::base16_chunk(
         "01000000"     // record count
         "ffffffff"     // bucket[0]...
@@ -511,9 +515,9 @@ BOOST_AUTO_TEST_CASE(query_archive__set_block__get_block__expected)
     const auto genesis_point_body = system::base16_chunk("");
     const auto genesis_spend_head = system::base16_chunk(
         "01000000"     // record count
-        "00000000"     // spend0_fk->
         "ffffffff"
         "ffffffff"
+        "00000000"     // spend0_fk->
         "ffffffff"
         "ffffffff");
 
@@ -531,9 +535,9 @@ BOOST_AUTO_TEST_CASE(query_archive__set_block__get_block__expected)
         "00");         // witness
     const auto genesis_txs_head = system::base16_chunk(
         "1300000000"   // slabs size
-        "0000000000"   // pk->
         "ffffffffff"
         "ffffffffff"
+        "0000000000"   // pk->
         "ffffffffff"
         "ffffffffff"
         "ffffffffff"
@@ -621,7 +625,9 @@ BOOST_AUTO_TEST_CASE(query_archive__set_block_txs__get_block__expected)
         "29ab5f49"     // timestamp
         "ffff001d"     // bits
         "1dac2b7c"     // nonce
-        "3ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a"); // merkle_root
+        "3ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a" // merkle_root
+        "0100010001000000000000000000000000000000000000000000000000000000" // work
+        "ffffff"); // skip_fk (terminal)
     const auto genesis_tx_head = system::base16_chunk(
         "01000000"     // record count
         "ffffffff"     // bucket[0]...
@@ -660,9 +666,9 @@ BOOST_AUTO_TEST_CASE(query_archive__set_block_txs__get_block__expected)
     const auto genesis_point_body = system::base16_chunk("");
     const auto genesis_spend_head = system::base16_chunk(
         "01000000"     // record count
-        "00000000"     // spend0_fk->
         "ffffffff"
         "ffffffff"
+        "00000000"     // spend0_fk->
         "ffffffff"
         "ffffffff");
 
@@ -680,9 +686,9 @@ BOOST_AUTO_TEST_CASE(query_archive__set_block_txs__get_block__expected)
         "00");         // witness
     const auto genesis_txs_head = system::base16_chunk(
         "1300000000"   // slabs size
-        "0000000000"   // pk->
         "ffffffffff"
         "ffffffffff"
+        "0000000000"   // pk->
         "ffffffffff"
         "ffffffffff"
         "ffffffffff"
@@ -758,6 +764,95 @@ BOOST_AUTO_TEST_CASE(query_archive__set_block_txs__get_block__expected)
     BOOST_REQUIRE(!query.is_malleable(0));
 }
 
+BOOST_AUTO_TEST_CASE(query_archive__set_block__parallel__expected_order)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.archive_threads = 4;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, test::context));
+
+    // A block of one batch is archived serially, regardless of threads.
+    BOOST_REQUIRE(query.set(test::block2a, test::context));
+
+    const auto link = query.to_header(test::block2a.hash());
+    const auto hashes = query.get_tx_keys(link);
+    BOOST_REQUIRE_EQUAL(hashes, test::block2a.transaction_hashes(false));
+
+    const auto pointer = query.get_block(link);
+    BOOST_REQUIRE(pointer);
+    BOOST_REQUIRE(*pointer == test::block2a);
+}
+
+BOOST_AUTO_TEST_CASE(query_archive__set_block__parallel_batches__expected_order)
+{
+    using namespace system::chain;
+    constexpr size_t batch = 64;
+    constexpr uint32_t count = 3 * batch - 42;
+
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.archive_threads = 4;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    // Distinct txs spanning three batches.
+    transactions txs{};
+    for (uint32_t index = 0; index < count; ++index)
+    {
+        txs.push_back(transaction
+        {
+            index,
+            inputs
+            {
+                input
+                {
+                    point{ system::one_hash, index },
+                    script{ { { opcode::pick } } },
+                    witness{ "[242424]" },
+                    index
+                }
+            },
+            outputs{ output{ index, script{ { { opcode::roll } } } } },
+            index
+        });
+    }
+
+    const block instance
+    {
+        header{ 0x31323334, test::genesis.hash(), system::null_hash, 0x41, 0x51, 0x61 },
+        txs
+    };
+
+    BOOST_REQUIRE(query.set(instance, test::context));
+    const auto link = query.to_header(instance.hash());
+    BOOST_REQUIRE_EQUAL(query.get_tx_keys(link), instance.transaction_hashes(false));
+
+    // Links are in block order in the txs slab.
+    const auto links = query.to_txs(link);
+    BOOST_REQUIRE_EQUAL(links.size(), count);
+    for (size_t index = 0; index < count; ++index)
+        BOOST_REQUIRE_EQUAL(links.at(index), query.to_tx(txs.at(index).hash(false)));
+
+    // Links increase within each batch, but batches may interleave.
+    for (size_t index = 0; index < count; ++index)
+        if (!is_zero(index % batch))
+            BOOST_REQUIRE_LT(links.at(sub1(index)), links.at(index));
+
+    auto sorted = links;
+    std::sort(sorted.begin(), sorted.end());
+    BOOST_REQUIRE(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+    const auto pointer = query.get_block(link);
+    BOOST_REQUIRE(pointer);
+    BOOST_REQUIRE(*pointer == instance);
+}
+
 // Moved to protected, set_link(block) covers.
 ////BOOST_AUTO_TEST_CASE(query_archive__set_links__get_block__expected)
 ////{
@@ -1072,7 +1167,9 @@ BOOST_AUTO_TEST_CASE(query_archive__get_header__invalid_parent__expected)
         "44434241" // timestamp
         "54535251" // bits
         "64636261" // nonce
-        "119192939495969798999a9b9c9d9e9f229192939495969798999a9b9c9d9e9f"); // merkle_root
+        "119192939495969798999a9b9c9d9e9f229192939495969798999a9b9c9d9e9f"  // merkle_root
+        "0000000000000000000000000000000000000000000000000000000000000000" // work (bits overflowed)
+        "ffffff"); // skip_fk (terminal)
 
     settings settings{};
     settings.header_buckets = 10;
@@ -1124,7 +1221,9 @@ BOOST_AUTO_TEST_CASE(query_archive__get_header__default__expected)
         "44434241" // timestamp
         "54535251" // bits
         "64636261" // nonce
-        "119192939495969798999a9b9c9d9e9f229192939495969798999a9b9c9d9e9f"); // merkle_root
+        "119192939495969798999a9b9c9d9e9f229192939495969798999a9b9c9d9e9f"  // merkle_root
+        "0000000000000000000000000000000000000000000000000000000000000000" // work (bits overflowed)
+        "ffffff"); // skip_fk (terminal)
 
     settings settings{};
     settings.header_buckets = 10;
@@ -556,6 +556,287 @@ BOOST_AUTO_TEST_CASE(query_confirm__block_confirmable__spend_non_coinbase__succe
     BOOST_REQUIRE_EQUAL(query.block_confirmable(2), error::success);
 }
 
+BOOST_AUTO_TEST_CASE(query_confirm__block_confirmable__parallel_spend_non_coinbase__success)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.confirm_threads = 4;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, context{ 0, 1, 0 }));
+    BOOST_REQUIRE(query.set_strong(1));
+
+    // block_spend_1a spends both block1a outputs (serial, as a small block).
+    BOOST_REQUIRE(query.set(test::block_spend_1a, context{ 0, 2, 0 }));
+    BOOST_REQUIRE(query.set_strong(2));
+    BOOST_REQUIRE_EQUAL(query.block_confirmable(2), error::success);
+}
+
+BOOST_AUTO_TEST_CASE(query_confirm__block_confirmable__parallel_missing_prevouts__success)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.confirm_threads = 4;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, context{ bip68, 1, 0 }));
+    BOOST_REQUIRE(query.set_strong(1));
+
+    // Small block is serial (block1a is missing all three input prevouts).
+    BOOST_REQUIRE_EQUAL(query.block_confirmable(1), error::success);
+}
+
+// Confirms a block of 80 spends (ten batches, above the serial threshold) in
+// which spends 11 and 30 are of an unconfirmed tx and spends 17 and 25 are of
+// missing prevouts.
+static code confirmable_spends(uint16_t threads) NOEXCEPT
+{
+    using namespace system::chain;
+    constexpr uint32_t spends = 80;
+    const auto pick = []() NOEXCEPT { return script{ { { opcode::pick } } }; };
+
+    BOOST_REQUIRE(test::clear(test::directory));
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.confirm_threads = threads;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    // Non-coinbase funding txs, with an output for each spend.
+    const auto fund = [&](uint32_t version) NOEXCEPT
+    {
+        outputs outs{};
+        for (uint32_t index = 0; index < spends; ++index)
+            outs.emplace_back(add1(index), pick());
+
+        return transaction
+        {
+            version,
+            inputs{ input{ point{ system::one_hash, version }, pick(), witness{}, 0 } },
+            outs,
+            0
+        };
+    };
+
+    const auto strong = fund(0x2a);
+    const auto weak = fund(0x2b);
+    const block block1
+    {
+        header{ 0x31323334, test::genesis.hash(), system::null_hash, 0x41, 0x51, 0x61 },
+        transactions{ strong }
+    };
+    const block block1w
+    {
+        header{ 0x31323334, test::genesis.hash(), system::null_hash, 0x42, 0x52, 0x62 },
+        transactions{ weak }
+    };
+
+    // The leading tx is positionally the coinbase, so is not confirmed.
+    transactions txs{};
+    txs.push_back(transaction
+    {
+        0x01,
+        inputs{ input{ point{ system::null_hash, point::null_index }, pick(),
+            witness{}, 0 } },
+        outputs{ output{ 0, pick() } },
+        0
+    });
+
+    for (uint32_t index = 0; index < spends; ++index)
+    {
+        const auto prevout = (index == 11u || index == 30u) ? weak.hash(false) :
+            ((index == 17u || index == 25u) ? system::one_hash :
+                strong.hash(false));
+
+        txs.push_back(transaction
+        {
+            0x02,
+            inputs{ input{ point{ prevout, index }, pick(), witness{}, 0 } },
+            outputs{ output{ index, pick() } },
+            0
+        });
+    }
+
+    const block block2
+    {
+        header{ 0x31323334, block1.hash(), system::null_hash, 0x43, 0x53, 0x63 },
+        txs
+    };
+
+    BOOST_REQUIRE(query.set(block1, database::context{ 0, 1, 0 }));
+    BOOST_REQUIRE(query.set(block1w, database::context{ 0, 1, 0 }));
+    BOOST_REQUIRE(query.set(block2, database::context{ 0, 2, 0 }));
+    BOOST_REQUIRE(query.set_strong(1));
+    BOOST_REQUIRE(query.set_strong(3));
+    return query.block_confirmable(3);
+}
+
+BOOST_AUTO_TEST_CASE(query_confirm__block_confirmable__parallel_batches__serial_result)
+{
+    // The lowest failing spend determines the result, as with serial.
+    const auto serial = confirmable_spends(1);
+    BOOST_REQUIRE_EQUAL(serial, error::unconfirmed_spend);
+    BOOST_REQUIRE_EQUAL(confirmable_spends(4), serial);
+    BOOST_REQUIRE_EQUAL(confirmable_spends(16), serial);
+}
+
+class prevouts_accessor
+  : public test::query_accessor
+{
+public:
+    using block_prevouts = test::query_accessor::block_prevouts;
+    using test::query_accessor::query_accessor;
+
+    bool populate_prevouts_(block_prevouts& out,
+        const tx_links& txs) const NOEXCEPT
+    {
+        return populate_prevouts(out, txs);
+    }
+};
+
+// A child of block1a with a coinbase and a tx for each spend of points.
+static system::chain::block spend_block(
+    const std_vector<system::chain::point>& points) NOEXCEPT
+{
+    using namespace system::chain;
+    const auto pick = []() NOEXCEPT { return script{ { { opcode::pick } } }; };
+
+    transactions txs{};
+    txs.push_back(transaction
+    {
+        0x01,
+        inputs{ input{ point{ system::null_hash, point::null_index }, pick(),
+            witness{}, 0 } },
+        outputs{ output{ 0, pick() } },
+        0
+    });
+
+    for (const auto& prevout: points)
+    {
+        txs.push_back(transaction
+        {
+            0x02,
+            inputs{ input{ point{ prevout }, pick(), witness{}, 0 } },
+            outputs{ output{ 0, pick() } },
+            0
+        });
+    }
+
+    return block
+    {
+        header{ 0x31323334, test::block1a.hash(), system::null_hash, 0x41, 0x51, 0x61 },
+        txs
+    };
+}
+
+BOOST_AUTO_TEST_CASE(query_confirm__populate_prevouts__shared_and_missing__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    prevouts_accessor query{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, context{ 0, 1, 0 }));
+    BOOST_REQUIRE(query.set_strong(1));
+
+    // Two spends of the block1a tx (one distinct prevout tx) and one missing.
+    const auto hash = test::block1a.transactions_ptr()->front()->hash(false);
+    const auto spender = spend_block(
+    {
+        { hash, 0x00 },
+        { hash, 0x01 },
+        { system::one_hash, 0x07 }
+    });
+
+    BOOST_REQUIRE(query.set(spender, context{ 0, 2, 0 }));
+    BOOST_REQUIRE(query.set_strong(2));
+
+    prevouts_accessor::block_prevouts prevouts{};
+    BOOST_REQUIRE(query.populate_prevouts_(prevouts, query.to_txs(2)));
+    BOOST_REQUIRE_EQUAL(prevouts.size(), 3u);
+
+    const auto tx = query.to_tx(hash);
+    BOOST_REQUIRE_EQUAL(prevouts.at(0).tx, tx);
+    BOOST_REQUIRE_EQUAL(prevouts.at(0).block, 1u);
+    BOOST_REQUIRE_EQUAL(prevouts.at(0).height, 1u);
+    BOOST_REQUIRE(!prevouts.at(0).coinbase);
+    BOOST_REQUIRE_EQUAL(prevouts.at(1).tx, tx);
+    BOOST_REQUIRE_EQUAL(prevouts.at(1).block, 1u);
+    BOOST_REQUIRE_EQUAL(prevouts.at(1).height, 1u);
+    BOOST_REQUIRE(prevouts.at(2).tx.is_terminal());
+    BOOST_REQUIRE(prevouts.at(2).block.is_terminal());
+
+    // The spends precede the missing prevout, which is reported.
+    BOOST_REQUIRE_EQUAL(query.block_confirmable(2), error::missing_previous_output);
+}
+
+BOOST_AUTO_TEST_CASE(query_confirm__populate_prevouts__duplicate_tx_hash__strong_instance)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    prevouts_accessor query{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, context{ 0, 1, 0 }));
+    BOOST_REQUIRE(query.set_strong(1));
+
+    // Write a second (weak) instance of the strong block1a tx, bypassing the
+    // tx guard as a write race would. The newer instance is found first.
+    const auto hash = test::block1a.transactions_ptr()->front()->hash(false);
+    const auto strong = query.to_tx(hash);
+    table::transaction::record record{};
+    BOOST_REQUIRE(store.tx.get(strong, record));
+    const auto weak = store.tx.put_link(hash, record);
+    BOOST_REQUIRE(!weak.is_terminal());
+    BOOST_REQUIRE_NE(weak, strong);
+    BOOST_REQUIRE_EQUAL(query.to_tx(hash), weak);
+
+    const auto spender = spend_block({ { hash, 0x00 } });
+    BOOST_REQUIRE(query.set(spender, context{ 0, 2, 0 }));
+    BOOST_REQUIRE(query.set_strong(2));
+
+    // The strong instance is resolved by to_strong.
+    prevouts_accessor::block_prevouts prevouts{};
+    BOOST_REQUIRE(query.populate_prevouts_(prevouts, query.to_txs(2)));
+    BOOST_REQUIRE_EQUAL(prevouts.size(), 1u);
+    BOOST_REQUIRE_EQUAL(prevouts.front().tx, strong);
+    BOOST_REQUIRE_EQUAL(prevouts.front().block, 1u);
+    BOOST_REQUIRE_EQUAL(prevouts.front().height, 1u);
+    BOOST_REQUIRE_EQUAL(query.block_confirmable(2), error::success);
+}
+
+BOOST_AUTO_TEST_CASE(query_confirm__populate_prevouts__weak_prevout__unconfirmed)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    prevouts_accessor query{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, context{ 0, 1, 0 }));
+
+    // block1a is not strong, so to_strong finds no strong instance.
+    const auto hash = test::block1a.transactions_ptr()->front()->hash(false);
+    const auto spender = spend_block({ { hash, 0x00 } });
+    BOOST_REQUIRE(query.set(spender, context{ 0, 2, 0 }));
+    BOOST_REQUIRE(query.set_strong(2));
+
+    prevouts_accessor::block_prevouts prevouts{};
+    BOOST_REQUIRE(query.populate_prevouts_(prevouts, query.to_txs(2)));
+    BOOST_REQUIRE_EQUAL(prevouts.size(), 1u);
+    BOOST_REQUIRE_EQUAL(prevouts.front().tx, query.to_tx(hash));
+    BOOST_REQUIRE(prevouts.front().block.is_terminal());
+    BOOST_REQUIRE_EQUAL(query.block_confirmable(2), error::unconfirmed_spend);
+}
+
 // These pas but test vectors need to be updated to create clear test conditions.
 ////BOOST_AUTO_TEST_CASE(query_confirm__block_confirmable__spend_coinbase_and_internal_immature__coinbase_maturity)
 ////{
@@ -116,4 +116,146 @@ BOOST_AUTO_TEST_CASE(query_context__get_candidate_chain_state__block1__expected)
     BOOST_REQUIRE(state->context() == expected);
 }
 
+BOOST_AUTO_TEST_CASE(query_context__get_candidate_chain_state__push_pop_window__expected)
+{
+    const system::settings system_settings{ system::chain::selection::mainnet };
+    database::settings database_settings{};
+    database_settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ database_settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, test::context));
+    BOOST_REQUIRE(query.set(test::block2, test::context));
+    BOOST_REQUIRE(query.set(test::block3, test::context));
+
+    // Warm the window, then advance and rewind it.
+    BOOST_REQUIRE(query.get_candidate_chain_state(system_settings));
+    BOOST_REQUIRE(query.push_candidate(query.to_header(test::block1.hash())));
+    BOOST_REQUIRE(query.push_candidate(query.to_header(test::block2.hash())));
+    BOOST_REQUIRE(query.pop_candidate());
+    BOOST_REQUIRE(query.push_candidate(query.to_header(test::block2.hash())));
+    BOOST_REQUIRE(query.push_candidate(query.to_header(test::block3.hash())));
+    const auto state = query.get_candidate_chain_state(system_settings);
+    BOOST_REQUIRE(state);
+
+    // Median of the three preceding timestamps, from the headers themselves.
+    std::vector<uint32_t> timestamps
+    {
+        test::genesis.header().timestamp(),
+        test::block1.header().timestamp(),
+        test::block2.header().timestamp()
+    };
+    std::sort(timestamps.begin(), timestamps.end());
+
+    BOOST_REQUIRE_EQUAL(state->height(), 3u);
+    BOOST_REQUIRE_EQUAL(state->timestamp(), test::block3.header().timestamp());
+    BOOST_REQUIRE_EQUAL(state->median_time_past(), timestamps.at(1));
+    BOOST_REQUIRE_EQUAL(state->minimum_block_version(), 1u);
+    BOOST_REQUIRE_EQUAL(state->work_required(), test::block2.header().bits());
+}
+
+BOOST_AUTO_TEST_CASE(query_context__get_candidate_chain_state__reorganized_by_other_query__expected)
+{
+    const system::settings system_settings{ system::chain::selection::mainnet };
+    database::settings database_settings{};
+    database_settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ database_settings };
+    test::query_accessor query{ store };
+    test::query_accessor other{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, test::context));
+    BOOST_REQUIRE(query.set(test::block2, test::context));
+    BOOST_REQUIRE(query.set(test::block1a, test::context));
+    BOOST_REQUIRE(query.set(test::block2a, test::context));
+    BOOST_REQUIRE(query.push_candidate(query.to_header(test::block1.hash())));
+    BOOST_REQUIRE(query.push_candidate(query.to_header(test::block2.hash())));
+
+    // Warm the window of the first query on candidates 0..2.
+    const auto before = query.get_candidate_chain_state(system_settings);
+    BOOST_REQUIRE(before);
+    BOOST_REQUIRE_EQUAL(before->work_required(), test::block1.header().bits());
+
+    // Reorganize the candidate chain through the other query.
+    BOOST_REQUIRE(other.pop_candidate());
+    BOOST_REQUIRE(other.pop_candidate());
+    BOOST_REQUIRE(other.push_candidate(other.to_header(test::block1a.hash())));
+    BOOST_REQUIRE(other.push_candidate(other.to_header(test::block2a.hash())));
+
+    // The first query must not use its stale window.
+    const auto state = query.get_candidate_chain_state(system_settings);
+    BOOST_REQUIRE(state);
+    BOOST_REQUIRE_EQUAL(state->height(), 2u);
+    BOOST_REQUIRE_EQUAL(state->timestamp(), test::block2a.header().timestamp());
+    BOOST_REQUIRE_EQUAL(state->median_time_past(), std::max(
+        test::genesis.header().timestamp(), test::block1a.header().timestamp()));
+    BOOST_REQUIRE_EQUAL(state->work_required(), test::block1a.header().bits());
+
+    // Popping through the other query is also reflected.
+    BOOST_REQUIRE(other.pop_candidate());
+    const auto popped = query.get_candidate_chain_state(system_settings);
+    BOOST_REQUIRE(popped);
+    BOOST_REQUIRE_EQUAL(popped->height(), 1u);
+    BOOST_REQUIRE_EQUAL(popped->work_required(), test::genesis.header().bits());
+}
+
+BOOST_AUTO_TEST_CASE(query_context__populate_retarget__long_chain__ancestor_timestamp)
+{
+    using chain_state = system::chain::chain_state;
+    class accessor
+      : public test::query_accessor
+    {
+    public:
+        using test::query_accessor::query_accessor;
+        bool populate_retarget_(chain_state::data& data,
+            const chain_state::map& map, header_link link) const NOEXCEPT
+        {
+            return populate_retarget(data, map, link);
+        }
+    };
+
+    constexpr uint32_t count = 100;
+    constexpr uint32_t timestamp = 0x01000000;
+    database::settings database_settings{};
+    database_settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ database_settings };
+    accessor query{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    auto previous = test::genesis.hash();
+    for (uint32_t height = 1; height <= count; ++height)
+    {
+        const system::chain::header header
+        {
+            0x31323334, previous, system::null_hash, timestamp + height,
+            0x1d00ffff, 0
+        };
+
+        BOOST_REQUIRE(query.set(header, database::context{ 0, height, 0 }));
+        previous = header.hash();
+    }
+
+    // The retarget timestamp is read from the ancestor at each height.
+    const auto top = query.to_header(previous);
+    chain_state::data data{};
+    data.height = count;
+    chain_state::map map{};
+    for (uint32_t height = 0; height <= count; ++height)
+    {
+        map.timestamp_retarget = height;
+        BOOST_REQUIRE(query.populate_retarget_(data, map, top));
+        BOOST_REQUIRE_EQUAL(data.timestamp.retarget, is_zero(height) ?
+            test::genesis.header().timestamp() : timestamp + height);
+    }
+
+    map.timestamp_retarget = add1(count);
+    BOOST_REQUIRE(!query.populate_retarget_(data, map, top));
+
+    map.timestamp_retarget = chain_state::map::unrequested;
+    BOOST_REQUIRE(query.populate_retarget_(data, map, top));
+    BOOST_REQUIRE_EQUAL(data.timestamp.retarget, max_uint32);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
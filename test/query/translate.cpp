@@ -295,11 +295,11 @@ BOOST_AUTO_TEST_CASE(query_translate__to_spend_tx__to_spend__expected)
     const auto spend_head = base16_chunk
     (
         "00000000"   // size
-        "03000000"   // pk->3
-        "ffffffff"
         "05000000"   // pk->5
         "ffffffff"
         "04000000"   // pk->4
+        "06000000"   // pk->6
+        "ffffffff"
     );
     const auto spend_body = base16_chunk
     (
@@ -331,7 +331,7 @@ BOOST_AUTO_TEST_CASE(query_translate__to_spend_tx__to_spend__expected)
         "ffffffff"   // sequence
         "6100000000" // input_fk->
 
-        "06000000"   // pk->6
+        "03000000"   // pk->3
         "00000000"   // fp: point_fk->
         "180000"     // fp: point_index
         "04000000"   // parent_fk->
@@ -747,6 +747,75 @@ BOOST_AUTO_TEST_CASE(query_translate__to_parent__always__expected)
     BOOST_REQUIRE_EQUAL(query.to_parent(5), header_link::terminal);
 }
 
+// to_ancestor
+
+BOOST_AUTO_TEST_CASE(query_translate__to_ancestor__skip_links__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context{ 0, 1, 0 }));
+    BOOST_REQUIRE(query.set(test::block2, context{ 0, 2, 0 }));
+    BOOST_REQUIRE(query.set(test::block3, context{ 0, 3, 0 }));
+
+    // Height 3 skips to height 1.
+    table::header::get_ancestry header{};
+    BOOST_REQUIRE(store.header.get(3, header));
+    BOOST_REQUIRE_EQUAL(header.skip_fk, 1u);
+
+    BOOST_REQUIRE_EQUAL(query.to_ancestor(3, 0), 0u);
+    BOOST_REQUIRE_EQUAL(query.to_ancestor(3, 1), 1u);
+    BOOST_REQUIRE_EQUAL(query.to_ancestor(3, 2), 2u);
+    BOOST_REQUIRE_EQUAL(query.to_ancestor(3, 3), 3u);
+    BOOST_REQUIRE_EQUAL(query.to_ancestor(2, 0), 0u);
+    BOOST_REQUIRE_EQUAL(query.to_ancestor(0, 0), 0u);
+    BOOST_REQUIRE_EQUAL(query.to_ancestor(3, 4), header_link::terminal);
+    BOOST_REQUIRE_EQUAL(query.to_ancestor(4, 0), header_link::terminal);
+}
+
+BOOST_AUTO_TEST_CASE(query_translate__to_ancestor__long_chain__parent_walk)
+{
+    constexpr uint32_t count = 100;
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    auto previous = test::genesis.hash();
+    for (uint32_t height = 1; height <= count; ++height)
+    {
+        const system::chain::header header
+        {
+            0x31323334, previous, system::null_hash, height, 0x1d00ffff, 0
+        };
+
+        BOOST_REQUIRE(query.set(header, context{ 0, height, 0 }));
+        previous = header.hash();
+    }
+
+    // Every ancestor of every header matches the parent walk.
+    // Headers are archived in height order, so the link of each is its height.
+    for (uint32_t top = 0; top <= count; ++top)
+    {
+        const header_link link{ top };
+        auto expected = link;
+        for (auto height = top; !is_zero(height); --height)
+        {
+            BOOST_REQUIRE_EQUAL(query.to_ancestor(link, height), expected);
+            expected = query.to_parent(expected);
+        }
+
+        BOOST_REQUIRE_EQUAL(query.to_ancestor(link, zero), expected);
+        BOOST_REQUIRE(query.to_parent(expected).is_terminal());
+        BOOST_REQUIRE(query.to_ancestor(link, add1(top)).is_terminal());
+    }
+}
+
 // to_txs
 
 BOOST_AUTO_TEST_CASE(query_translate__to_txs__always__expected)
@@ -841,24 +910,24 @@ BOOST_AUTO_TEST_CASE(query_translate__to_spenders__point__expected)
     const auto spend_head = system::base16_chunk
     (
         "00000000" // size
-        "00000000"
-        "ffffffff"
+        "07000000"
         "08000000"
         "09000000"
-        "01000000"
+        "03000000"
+        "06000000"
     );
     const auto spend_body = system::base16_chunk
     (
         "ffffffff""ffffffff""ffffff""00000000""ffffffff""0000000000"
-        "03000000""00000000""180000""01000000""2a000000""4f00000000"
+        "00000000""00000000""180000""01000000""2a000000""4f00000000"
         "ffffffff""00000000""2a0000""01000000""18000000""5700000000"
         "ffffffff""01000000""2b0000""01000000""19000000""5f00000000"
-        "02000000""02000000""000000""02000000""a2000000""6700000000"
-        "ffffffff""02000000""010000""02000000""81000000""6f00000000"
-        "04000000""00000000""200000""03000000""a2000000""7700000000"
-        "05000000""00000000""210000""03000000""81000000""7f00000000"
-        "06000000""02000000""000000""04000000""a5000000""8700000000"
-        "07000000""02000000""010000""04000000""85000000""8f00000000"
+        "ffffffff""02000000""000000""02000000""a2000000""6700000000"
+        "01000000""02000000""010000""02000000""81000000""6f00000000"
+        "ffffffff""00000000""200000""03000000""a2000000""7700000000"
+        "02000000""00000000""210000""03000000""81000000""7f00000000"
+        "04000000""02000000""000000""04000000""a5000000""8700000000"
+        "05000000""02000000""010000""04000000""85000000""8f00000000"
     );
     const auto input_head = system::base16_chunk
     (
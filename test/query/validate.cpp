@@ -88,6 +88,25 @@ BOOST_AUTO_TEST_CASE(query_validate__get_bits__genesis__expected)
     BOOST_REQUIRE_EQUAL(bits, 0x1d00ffff_u32);
 }
 
+BOOST_AUTO_TEST_CASE(query_validate__get_cumulative_work__chain__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE_EQUAL(store.create(events_handler), error::success);
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, test::context));
+
+    system::uint256_t work{};
+    BOOST_REQUIRE(!query.get_cumulative_work(work, 2));
+    BOOST_REQUIRE(query.get_cumulative_work(work, 0));
+    BOOST_REQUIRE_EQUAL(work, test::genesis.header().proof());
+    BOOST_REQUIRE(query.get_cumulative_work(work, 1));
+    BOOST_REQUIRE_EQUAL(work, test::genesis.header().proof() +
+        test::block1.header().proof());
+}
+
 BOOST_AUTO_TEST_CASE(query_validate__get_context__genesis__default)
 {
     settings settings{};
@@ -24,57 +24,84 @@ BOOST_AUTO_TEST_CASE(settings__construct__default__expected)
 {
     database::settings configuration;
     BOOST_REQUIRE_EQUAL(configuration.path, "bitcoin");
+    BOOST_REQUIRE_EQUAL(configuration.reservation, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.archive_threads, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.confirm_threads, 1u);
+    BOOST_REQUIRE(configuration.head_advice == advice_t::random);
+    BOOST_REQUIRE(!configuration.anonymous_heads);
+    BOOST_REQUIRE(!configuration.power2_buckets);
+    BOOST_REQUIRE_EQUAL(configuration.rehash_load, 0u);
+    BOOST_REQUIRE(!configuration.fingerprint_heads);
 
     // Archives.
     BOOST_REQUIRE_EQUAL(configuration.header_buckets, 100u);
     BOOST_REQUIRE_EQUAL(configuration.header_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.header_rate, 50u);
+    BOOST_REQUIRE(configuration.header_advice == advice_t::random);
     BOOST_REQUIRE_EQUAL(configuration.point_buckets, 100u);
     BOOST_REQUIRE_EQUAL(configuration.point_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.point_rate, 50u);
+    BOOST_REQUIRE(configuration.point_advice == advice_t::random);
+    BOOST_REQUIRE_EQUAL(configuration.point_filter, 0u);
     BOOST_REQUIRE_EQUAL(configuration.input_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.input_rate, 50u);
+    BOOST_REQUIRE(configuration.input_advice == advice_t::normal);
     BOOST_REQUIRE_EQUAL(configuration.output_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.output_rate, 50u);
+    BOOST_REQUIRE(configuration.output_advice == advice_t::normal);
     BOOST_REQUIRE_EQUAL(configuration.puts_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.puts_rate, 50u);
+    BOOST_REQUIRE(configuration.puts_advice == advice_t::normal);
     BOOST_REQUIRE_EQUAL(configuration.tx_buckets, 100u);
     BOOST_REQUIRE_EQUAL(configuration.tx_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.tx_rate, 50u);
+    BOOST_REQUIRE(configuration.tx_advice == advice_t::random);
+    BOOST_REQUIRE_EQUAL(configuration.tx_filter, 0u);
     BOOST_REQUIRE_EQUAL(configuration.txs_buckets, 100u);
     BOOST_REQUIRE_EQUAL(configuration.txs_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.txs_rate, 50u);
+    BOOST_REQUIRE(configuration.txs_advice == advice_t::random);
 
     // Indexes.
     BOOST_REQUIRE_EQUAL(configuration.address_buckets, 100u);
     BOOST_REQUIRE_EQUAL(configuration.address_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.address_rate, 50u);
+    BOOST_REQUIRE(configuration.address_advice == advice_t::random);
     BOOST_REQUIRE_EQUAL(configuration.candidate_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.candidate_rate, 50u);
+    BOOST_REQUIRE(configuration.candidate_advice == advice_t::normal);
     BOOST_REQUIRE_EQUAL(configuration.confirmed_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.confirmed_rate, 50u);
+    BOOST_REQUIRE(configuration.confirmed_advice == advice_t::normal);
     BOOST_REQUIRE_EQUAL(configuration.spend_buckets, 100u);
     BOOST_REQUIRE_EQUAL(configuration.spend_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.spend_rate, 50u);
+    BOOST_REQUIRE(configuration.spend_advice == advice_t::random);
     BOOST_REQUIRE_EQUAL(configuration.strong_tx_buckets, 100u);
     BOOST_REQUIRE_EQUAL(configuration.strong_tx_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.strong_tx_rate, 50u);
+    BOOST_REQUIRE(configuration.strong_tx_advice == advice_t::random);
 
     // Caches.
     BOOST_REQUIRE_EQUAL(configuration.validated_bk_buckets, 100u);
     BOOST_REQUIRE_EQUAL(configuration.validated_bk_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.validated_bk_rate, 50u);
+    BOOST_REQUIRE(configuration.validated_bk_advice == advice_t::random);
     BOOST_REQUIRE_EQUAL(configuration.validated_tx_buckets, 100u);
     BOOST_REQUIRE_EQUAL(configuration.validated_tx_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.validated_tx_rate, 50u);
+    BOOST_REQUIRE(configuration.validated_tx_advice == advice_t::random);
     BOOST_REQUIRE_EQUAL(configuration.neutrino_buckets, 100u);
     BOOST_REQUIRE_EQUAL(configuration.neutrino_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.neutrino_rate, 50u);
+    BOOST_REQUIRE(configuration.neutrino_advice == advice_t::random);
     ////BOOST_REQUIRE_EQUAL(configuration.bootstrap_size, 1u);
     ////BOOST_REQUIRE_EQUAL(configuration.bootstrap_rate, 50u);
+    ////BOOST_REQUIRE(configuration.bootstrap_advice == advice_t::random);
     ////BOOST_REQUIRE_EQUAL(configuration.buffer_buckets, 100u);
     ////BOOST_REQUIRE_EQUAL(configuration.buffer_size, 1u);
     ////BOOST_REQUIRE_EQUAL(configuration.buffer_rate, 50u);
+    ////BOOST_REQUIRE(configuration.buffer_advice == advice_t::random);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
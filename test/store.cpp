@@ -275,6 +275,67 @@ BOOST_AUTO_TEST_CASE(store__open__created__success)
     BOOST_REQUIRE(!instance.close(events));
 }
 
+BOOST_AUTO_TEST_CASE(store__open__missing_version__store_version)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    store<map> instance{ configuration };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(!instance.close(events));
+    BOOST_REQUIRE(test::remove(configuration.path / schema::meta::version));
+    BOOST_REQUIRE_EQUAL(instance.open(events), error::store_version);
+}
+
+BOOST_AUTO_TEST_CASE(store__open__prior_version__store_version)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    store<map> instance{ configuration };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(!instance.close(events));
+
+    const auto prior = system::to_little_endian(sub1(schema::version));
+    const auto file = configuration.path / schema::meta::version;
+    BOOST_REQUIRE(test::remove(file));
+    BOOST_REQUIRE(!file::create_file_ex(file, prior.data(), prior.size()));
+    BOOST_REQUIRE_EQUAL(instance.open(events), error::store_version);
+}
+
+BOOST_AUTO_TEST_CASE(store__writeback__opened__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    store<map> instance{ configuration };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(!instance.writeback(events));
+    BOOST_REQUIRE(!instance.snapshot(events));
+    BOOST_REQUIRE(!instance.close(events));
+}
+
+BOOST_AUTO_TEST_CASE(store__create__ram_heads__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    store<map, ram_storage> instance{ configuration };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(!instance.snapshot(events));
+    BOOST_REQUIRE(!instance.close(events));
+}
+
+BOOST_AUTO_TEST_CASE(store__construct__power2_buckets__rounded_up)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.power2_buckets = true;
+    configuration.header_buckets = 100;
+    configuration.point_buckets = 0;
+    configuration.tx_buckets = 128;
+    store<map> instance{ configuration };
+    BOOST_REQUIRE_EQUAL(instance.header.buckets(), 128u);
+    BOOST_REQUIRE_EQUAL(instance.point.buckets(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.tx.buckets(), 128u);
+}
+
 // snapshot
 // ----------------------------------------------------------------------------
 
@@ -571,6 +632,101 @@ BOOST_AUTO_TEST_CASE(store__restore__primary_secondary_loaded__open_failure)
 // backup-restore
 // ----------------------------------------------------------------------------
 
+// rebuild
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(store__rebuild__uncreated__failure)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE(instance.rebuild(events));
+    BOOST_REQUIRE(!test::exists(instance.flush_lock_file()));
+    BOOST_REQUIRE(!test::exists(instance.process_lock_file()));
+}
+
+BOOST_AUTO_TEST_CASE(store__rebuild__flush_locked__flush_lock)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(!instance.close(events));
+    BOOST_REQUIRE(test::create(flush_lock_file(configuration.path)));
+    BOOST_REQUIRE_EQUAL(instance.rebuild(events), error::flush_lock);
+}
+
+BOOST_AUTO_TEST_CASE(store__rebuild__changed_buckets__opens)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+
+    {
+        test::map_store instance{ configuration };
+        BOOST_REQUIRE(!instance.create(events));
+        BOOST_REQUIRE(!instance.close(events));
+    }
+
+    configuration.point_buckets = 42;
+    configuration.spend_buckets = 7;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE_EQUAL(instance.open(events), error::verify_table);
+    BOOST_REQUIRE(!instance.rebuild(events));
+
+    // leaves closed and unlocked, with a snapshot of rebuilt heads
+    BOOST_REQUIRE(!test::exists(instance.flush_lock_file()));
+    BOOST_REQUIRE(!test::exists(instance.process_lock_file()));
+    BOOST_REQUIRE(test::folder(configuration.path / schema::dir::primary));
+
+    BOOST_REQUIRE(!instance.open(events));
+    BOOST_REQUIRE_EQUAL(instance.point.buckets(), 42u);
+    BOOST_REQUIRE_EQUAL(instance.spend.buckets(), 7u);
+    BOOST_REQUIRE(!instance.close(events));
+}
+
+BOOST_AUTO_TEST_CASE(store__rebuild__fingerprint_heads__round_trip)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.fingerprint_heads = true;
+    configuration.point_buckets = 5;
+
+    std_vector<hash_digest> keys{};
+    for (uint8_t value = 0; value < 20; ++value)
+        keys.push_back({ value, value, 0x42 });
+
+    {
+        test::map_store instance{ configuration };
+        BOOST_REQUIRE(!instance.create(events));
+        for (const auto& key: keys)
+            BOOST_REQUIRE(!instance.point.put_link(key, table::point::record{}).is_terminal());
+
+        BOOST_REQUIRE(!instance.close(events));
+    }
+
+    // The existing bucket count is implied by the fingerprinted slot width.
+    const auto file = configuration.path / schema::dir::heads /
+        (schema::archive::point + schema::ext::head);
+    BOOST_REQUIRE_EQUAL(table::point::to_buckets(
+        std::filesystem::file_size(file), true), 5u);
+    BOOST_REQUIRE_EQUAL(table::point::to_buckets(
+        std::filesystem::file_size(file), false), 0u);
+
+    configuration.point_buckets = 11;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE_EQUAL(instance.open(events), error::verify_table);
+    BOOST_REQUIRE(!instance.rebuild(events));
+    BOOST_REQUIRE(!instance.open(events));
+    BOOST_REQUIRE_EQUAL(instance.point.buckets(), 11u);
+    BOOST_REQUIRE_EQUAL(table::point::to_buckets(instance.point.head_size(), true), 11u);
+
+    for (const auto& key: keys)
+        BOOST_REQUIRE(instance.point.exists(key));
+
+    BOOST_REQUIRE(!instance.point.exists(hash_digest{ 0x42 }));
+    BOOST_REQUIRE(!instance.close(events));
+}
+
 BOOST_AUTO_TEST_CASE(store__restore__snapshot__success_unlocks)
 {
     settings configuration{};
@@ -24,6 +24,7 @@ BOOST_AUTO_TEST_SUITE(header_tests)
 using namespace system;
 constexpr hash_digest key = base16_array("110102030405060708090a0b0c0d0e0f220102030405060708090a0b0c0d0e0f");
 constexpr hash_digest merkle_root = base16_array("330102030405060708090a0b0c0d0e0f440102030405060708090a0b0c0d0e0f");
+constexpr hash_digest work = base16_array("550102030405060708090a0b0c0d0e0f660102030405060708090a0b0c0d0e0f");
 constexpr table::header::record expected
 {
     {}, // schema::header [all const static members]
@@ -38,7 +39,9 @@ constexpr table::header::record expected
     0x56341206_u32, // timestamp
     0x56341207_u32, // bits
     0x56341208_u32, // nonce
-    merkle_root
+    merkle_root,
+    work,
+    0x00341209_u32  // skip_fk
 };
 const system::chain::header expected_header
 {
@@ -70,6 +73,9 @@ const data_chunk expected_file
     0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
 
     // --------------------------------------------------------------------------------------------
 
@@ -90,7 +96,10 @@ const data_chunk expected_file
     0x07, 0x12, 0x34, 0x56,
     0x08, 0x12, 0x34, 0x56,
     0x33, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
-    0x44, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+    0x44, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x55, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x66, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x09, 0x12, 0x34
 };
 
 BOOST_AUTO_TEST_CASE(header__put__get__expected)
@@ -124,7 +133,9 @@ BOOST_AUTO_TEST_CASE(header__put_ptr__get__expected)
         {},
         expected.ctx,
         expected.parent_fk,
-        system::to_shared(expected_header)
+        system::to_shared(expected_header),
+        expected.work,
+        expected.skip_fk
     };
     BOOST_REQUIRE(!instance.put_link(key, put_ptr).is_terminal());
     BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_file);
@@ -153,7 +164,9 @@ BOOST_AUTO_TEST_CASE(header__put_ref__get__expected)
         {},
         expected.ctx,
         expected.parent_fk,
-        expected_header
+        expected_header,
+        expected.work,
+        expected.skip_fk
     };
     BOOST_REQUIRE(!instance.put_link(key, put_ref).is_terminal());
     BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_file);
@@ -226,6 +239,16 @@ BOOST_AUTO_TEST_CASE(header__put__get_context__expected)
     BOOST_REQUIRE(instance.get(1, context));
     BOOST_REQUIRE(context.ctx == expected.ctx);
 
+    table::header::get_ancestry ancestry{};
+    BOOST_REQUIRE(instance.get(1, ancestry));
+    BOOST_REQUIRE_EQUAL(ancestry.height, expected.ctx.height);
+    BOOST_REQUIRE_EQUAL(ancestry.parent_fk, expected.parent_fk);
+    BOOST_REQUIRE_EQUAL(ancestry.skip_fk, expected.skip_fk);
+
+    table::header::get_work cumulative{};
+    BOOST_REQUIRE(instance.get(1, cumulative));
+    BOOST_REQUIRE_EQUAL(cumulative.work, expected.work);
+
     table::header::get_check_context check_context{};
     BOOST_REQUIRE(instance.get(1, check_context));
     BOOST_REQUIRE(check_context.ctx == expected.ctx);
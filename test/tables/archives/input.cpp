@@ -95,4 +95,52 @@ BOOST_AUTO_TEST_CASE(input__put__non_empty_get__expected)
     BOOST_REQUIRE(element == expected);
 }
 
+BOOST_AUTO_TEST_CASE(input__put_refs__get__expected)
+{
+    const table::input::slab expected
+    {
+        {}, // schema::input [all const static members]
+        chain::script{ { chain::opcode::checkmultisigverify, chain::opcode::op_return } },
+        chain::witness{ { { 0x42 }, { 0x01, 0x02, 0x03 } } }
+    };
+
+    const chain::input_cptrs inputs
+    {
+        to_shared<chain::input>(),
+        to_shared<chain::input>(chain::point{}, expected.script,
+            expected.witness, 0u)
+    };
+
+    const data_chunk expected_file
+    {
+        // slab0
+        0x00, // script
+        0x00, // witness
+
+        // slab1
+        0x02, 0xaf, 0x6a, // script
+        0x02, 0x01, 0x42, 0x03, 0x01, 0x02, 0x03 // witness
+    };
+
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::input instance{ head_store, body_store };
+    BOOST_REQUIRE(instance.create());
+
+    const table::input::put_refs refs{ {}, inputs };
+    BOOST_REQUIRE_EQUAL(refs.count(), expected_file.size());
+
+    const auto link = instance.allocate(refs.count());
+    BOOST_REQUIRE_EQUAL(link, 0u);
+    BOOST_REQUIRE(instance.put(link, refs));
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_file);
+
+    table::input::slab element{};
+    BOOST_REQUIRE(instance.get(0, element));
+    BOOST_REQUIRE(element == table::input::slab{});
+
+    BOOST_REQUIRE(instance.get(2u, element));
+    BOOST_REQUIRE(element == expected);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
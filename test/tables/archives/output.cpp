@@ -62,4 +62,28 @@ BOOST_AUTO_TEST_CASE(output__put__get__expected)
     BOOST_REQUIRE(element == expected);
 }
 
+BOOST_AUTO_TEST_CASE(output__put_refs__get__expected)
+{
+    const chain::output_cptrs outputs
+    {
+        to_shared<chain::output>(0_u64, chain::script{}),
+        to_shared<chain::output>(expected.value, chain::script{})
+    };
+
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::output instance{ head_store, body_store };
+
+    const table::output::put_refs refs{ {}, expected.parent_fk, outputs };
+    BOOST_REQUIRE_EQUAL(refs.count(), slab0_size + 14u);
+
+    const auto link = instance.allocate(refs.count());
+    BOOST_REQUIRE_EQUAL(link, 0u);
+    BOOST_REQUIRE(instance.put(link, refs));
+
+    table::output::slab element{};
+    BOOST_REQUIRE(instance.get<table::output::slab>(slab0_size, element));
+    BOOST_REQUIRE(element == expected);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
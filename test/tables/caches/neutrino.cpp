@@ -30,18 +30,18 @@ const data_chunk expected_head = base16_chunk
 (
     "0000000000"
     "ffffffffff"
-    "2a00000000"
-    "ffffffffff"
     "ffffffffff"
+    "2a00000000"
+    "0000000000"
     "ffffffffff"
 );
 const data_chunk closed_head = base16_chunk
 (
     "5600000000"
     "ffffffffff"
-    "2a00000000"
-    "ffffffffff"
     "ffffffffff"
+    "2a00000000"
+    "0000000000"
     "ffffffffff"
 );
 const data_chunk expected_body = base16_chunk
@@ -51,7 +51,7 @@ const data_chunk expected_body = base16_chunk
     "0000000000000000000000000000000000000000000000000000000000000000" // null_hash
     "0142"       // size/bytes
 
-    "0000000000" // next->
+    "ffffffffff" // next->end
     "a1a2a3"     // key2
     "0100000000000000000000000000000000000000000000000000000000000000" // one_hash
     "03abcdef"   // size/bytes
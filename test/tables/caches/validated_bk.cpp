@@ -30,18 +30,18 @@ const data_chunk expected_head = base16_chunk
 (
     "000000"
     "ffffff"
-    "100000"
-    "ffffff"
     "ffffff"
+    "100000"
+    "000000"
     "ffffff"
 );
 const data_chunk closed_head = base16_chunk
 (
     "180000"
     "ffffff"
-    "100000"
-    "ffffff"
     "ffffff"
+    "100000"
+    "000000"
     "ffffff"
 );
 const data_chunk expected_body = base16_chunk
@@ -51,7 +51,7 @@ const data_chunk expected_body = base16_chunk
     "42"      // code1
     "ff8877665544332211" // fees1
 
-    "000000"  // next->
+    "ffffff"  // next->end
     "a1a2a3"  // key2
     "ab"      // code2
     "42"      // fees2
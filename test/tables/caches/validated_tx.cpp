@@ -75,8 +75,8 @@ const table::validated_tx::slab out2
 const data_chunk expected_head = base16_chunk
 (
     "0000000000"
-    "2300000000"
     "ffffffffff"
+    "2300000000"
     "ffffffffff"
     "ffffffffff"
     "ffffffffff"
@@ -84,8 +84,8 @@ const data_chunk expected_head = base16_chunk
 const data_chunk closed_head = base16_chunk
 (
     "3a00000000"
-    "2300000000"
     "ffffffffff"
+    "2300000000"
     "ffffffffff"
     "ffffffffff"
     "ffffffffff"
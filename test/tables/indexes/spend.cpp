@@ -30,21 +30,21 @@ const table::spend::record in1{ {}, 0xaabbccdd, 1, 2 };
 const table::spend::record in2{ {}, 0x11223344, 3, 4 };
 const data_chunk expected_head = base16_chunk
 (
+    "00000000"
+    "01000000"
     "00000000"
     "ffffffff"
     "ffffffff"
     "ffffffff"
-    "01000000"
-    "ffffffff"
 );
 const data_chunk closed_head = base16_chunk
 (
     "02000000"
+    "01000000"
+    "00000000"
     "ffffffff"
     "ffffffff"
     "ffffffff"
-    "01000000"
-    "ffffffff"
 );
 const data_chunk expected_body = base16_chunk
 (
@@ -54,7 +54,7 @@ const data_chunk expected_body = base16_chunk
     "01000000"       // sequence1
     "0200000000"     // input_fk1
 
-    "00000000"       // next->
+    "ffffffff"       // next->end
     "a1a2a3a4a5a6a7" // key2
     "44332211"       // parent_fk2
     "03000000"       // sequence2
@@ -31,8 +31,8 @@ const table::strong_tx::record out2{ {}, 0x00223344, true };
 const data_chunk expected_head = base16_chunk
 (
     "00000000"
-    "01000000"
     "ffffffff"
+    "01000000"
     "ffffffff"
     "ffffffff"
     "ffffffff"
@@ -40,8 +40,8 @@ const data_chunk expected_head = base16_chunk
 const data_chunk closed_head = base16_chunk
 (
     "02000000"
-    "01000000"
     "ffffffff"
+    "01000000"
     "ffffffff"
     "ffffffff"
     "ffffffff"
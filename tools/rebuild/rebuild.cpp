@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <charconv>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <bitcoin/system.hpp>
+#include <bitcoin/database.hpp>
+
+using namespace bc;
+using namespace bc::database;
+
+// Bucket count implied by the size of an existing head (zero if none).
+template <typename Table>
+uint32_t existing(const std::filesystem::path& folder, const std::string& name,
+    bool fingerprints=false)
+{
+    std::error_code ec{};
+    const auto file = folder / schema::dir::heads / (name + schema::ext::head);
+    const auto size = std::filesystem::file_size(file, ec);
+    return ec ? 0u : system::narrow_cast<uint32_t>(
+        Table::to_buckets(system::possible_narrow_cast<size_t>(size),
+            fingerprints));
+}
+
+// Parse a nonzero unsigned value (zero if invalid).
+template <typename Value>
+Value parse(const std::string& token)
+{
+    Value value{};
+    const auto end = token.data() + token.size();
+    const auto result = std::from_chars(token.data(), end, value);
+    return result.ec != std::errc{} || result.ptr != end ? Value{} : value;
+}
+
+// Reindex the hash tables of a closed store to new bucket counts.
+// Unspecified tables retain their existing bucket counts. The head format
+// options must match those with which the store was created.
+// usage: rebuild <directory> [<option>=<value>]...
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: rebuild <directory> [<option>=<value>]..."
+            << std::endl;
+        return -1;
+    }
+
+    settings configuration{};
+    configuration.path = argv[1];
+
+    std::unordered_map<std::string, std::string> options{};
+    for (auto arg = 2; arg < argc; ++arg)
+    {
+        const std::string token{ argv[arg] };
+        const auto split = token.find('=');
+        if (split == std::string::npos || is_zero(split) ||
+            add1(split) == token.size() ||
+            !options.emplace(token.substr(0, split),
+                token.substr(add1(split))).second)
+        {
+            std::cerr << "invalid argument: " << token << std::endl;
+            return -1;
+        }
+    }
+
+    const auto flag = [&](const std::string& name, bool& value)
+    {
+        const auto it = options.find(name);
+        if (it == options.end())
+            return true;
+
+        if (it->second != "true" && it->second != "false")
+            return false;
+
+        value = (it->second == "true");
+        options.erase(it);
+        return true;
+    };
+
+    const auto number = [&](const std::string& name, auto& value)
+    {
+        using value_t = std::remove_reference_t<decltype(value)>;
+        const auto it = options.find(name);
+        if (it == options.end())
+            return true;
+
+        value = parse<value_t>(it->second);
+        options.erase(it);
+        return !is_zero(value);
+    };
+
+    // Head format and filter options (before existing bucket counts).
+    if (!flag("fingerprint_heads", configuration.fingerprint_heads) ||
+        !flag("power2_buckets", configuration.power2_buckets) ||
+        !number("rehash_load", configuration.rehash_load) ||
+        !number("point_filter", configuration.point_filter) ||
+        !number("tx_filter", configuration.tx_filter))
+    {
+        std::cerr << "invalid option value" << std::endl;
+        return -1;
+    }
+
+    const auto& path = configuration.path;
+    const auto prints = configuration.fingerprint_heads;
+    configuration.header_buckets = existing<table::header>(path, schema::archive::header);
+    configuration.point_buckets = existing<table::point>(path, schema::archive::point, prints);
+    configuration.spend_buckets = existing<table::spend>(path, schema::archive::spend);
+    configuration.tx_buckets = existing<table::transaction>(path, schema::archive::tx, prints);
+    configuration.txs_buckets = existing<table::txs>(path, schema::archive::txs);
+    configuration.strong_tx_buckets = existing<table::strong_tx>(path, schema::indexes::strong_tx);
+    configuration.validated_bk_buckets = existing<table::validated_bk>(path, schema::caches::validated_bk);
+    configuration.validated_tx_buckets = existing<table::validated_tx>(path, schema::caches::validated_tx);
+    configuration.address_buckets = existing<table::address>(path, schema::optionals::address, prints);
+    configuration.neutrino_buckets = existing<table::neutrino>(path, schema::optionals::neutrino);
+
+    const std::unordered_map<std::string, uint32_t*> buckets
+    {
+        { "header", &configuration.header_buckets },
+        { "point", &configuration.point_buckets },
+        { "spend", &configuration.spend_buckets },
+        { "tx", &configuration.tx_buckets },
+        { "txs", &configuration.txs_buckets },
+        { "strong_tx", &configuration.strong_tx_buckets },
+        { "validated_bk", &configuration.validated_bk_buckets },
+        { "validated_tx", &configuration.validated_tx_buckets },
+        { "address", &configuration.address_buckets },
+        { "neutrino", &configuration.neutrino_buckets }
+    };
+
+    for (const auto& option: options)
+    {
+        const auto it = buckets.find(option.first);
+        const auto value = parse<uint32_t>(option.second);
+        if (it == buckets.end() || is_zero(value))
+        {
+            std::cerr << "invalid argument: " << option.first << "="
+                << option.second << std::endl;
+            return -1;
+        }
+
+        *it->second = value;
+    }
+
+    using store_t = store<map>;
+    store_t store{ configuration };
+    const auto ec = store.rebuild([](event_t event, table_t table)
+    {
+        std::cout << store_t::events.at(event) << " "
+            << store_t::tables.at(table) << std::endl;
+    });
+
+    if (ec)
+    {
+        std::cerr << ec.message() << std::endl;
+        return -1;
+    }
+
+    return 0;
+}